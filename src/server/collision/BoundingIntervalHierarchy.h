@@ -116,9 +116,22 @@ class BIH
             delete[] dat.indices;
         }
         uint32 primCount() const { return objects.size(); }
+        // primitive stored at given position, leaves reference consecutive positions
+        uint32 primAt(uint32 position) const { return objects[position]; }
 
         template<typename RayCallback>
         void intersectRay(const G3D::Ray &r, RayCallback& intersectCallback, float &maxDist, bool stopAtFirst=false) const
+        {
+            PrimitiveLeafCallback<RayCallback> leafCallback(intersectCallback, objects);
+            intersectRayLeaves(r, leafCallback, maxDist, stopAtFirst);
+        }
+
+        /* Same traversal as intersectRay, but the callback gets whole leaves:
+           bool operator()(const G3D::Ray& ray, uint32 position, uint32 count, float& maxDist, bool stopAtFirst)
+           where primitives of the leaf are primAt(position) ... primAt(position + count - 1).
+           Lets callers test all primitives of a leaf at once (see GroupModel::IntersectRay). */
+        template<typename LeafCallback>
+        void intersectRayLeaves(const G3D::Ray &r, LeafCallback& leafCallback, float &maxDist, bool stopAtFirst=false) const
         {
             float intervalMin = -1.f;
             float intervalMax = -1.f;
@@ -216,11 +229,10 @@ class BIH
                         {
                             // leaf - test some objects
                             int n = tree[node + 1];
-                            while (n > 0) {
-                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirst);
+                            if (n > 0)
+                            {
+                                bool hit = leafCallback(r, offset, n, maxDist, stopAtFirst);
                                 if (stopAtFirst && hit) return;
-                                --n;
-                                ++offset;
                             }
                             break;
                         }
@@ -338,6 +350,26 @@ class BIH
         bool readFromFile(FILE* rf);
 
     protected:
+        template<typename RayCallback>
+        struct PrimitiveLeafCallback
+        {
+            PrimitiveLeafCallback(RayCallback& callback, std::vector<uint32> const& objs) : intersectCallback(callback), objects(objs) { }
+            bool operator()(const G3D::Ray &r, uint32 position, uint32 count, float &maxDist, bool stopAtFirst)
+            {
+                bool hit = false;
+                for (; count > 0; --count, ++position)
+                {
+                    hit = intersectCallback(r, objects[position], maxDist, stopAtFirst);
+                    if (stopAtFirst && hit)
+                        return true;
+                }
+                return hit;
+            }
+
+            RayCallback& intersectCallback;
+            std::vector<uint32> const& objects;
+        };
+
         std::vector<uint32> tree;
         std::vector<uint32> objects;
         G3D::AABox bounds;
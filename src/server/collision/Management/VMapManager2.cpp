@@ -36,7 +36,8 @@ using G3D::Vector3;
 
 namespace VMAP
 {
-    VMapManager2::VMapManager2()
+    VMapManager2::VMapManager2() : iUnusedModelCacheSize(0), iModelLoads(0), iModelCacheHits(0), iModelEvictions(0),
+        iResidentModels(0), iResidentSize(0), iTileLoads(0), iTileUnloads(0)
     {
     }
 
@@ -46,10 +47,9 @@ namespace VMAP
         {
             delete i->second;
         }
-        for (ModelFileMap::iterator i = iLoadedModelFiles.begin(); i != iLoadedModelFiles.end(); ++i)
-        {
-            delete i->second.getModel();
-        }
+        for (uint32 shard = 0; shard < MODEL_CACHE_SHARDS; ++shard)
+            for (ModelFileMap::iterator i = iModelShards[shard].iModels.begin(); i != iModelShards[shard].iModels.end(); ++i)
+                delete i->second.getModel();
     }
 
     Vector3 VMapManager2::convertPositionToInternalRep(float x, float y, float z) const
@@ -78,6 +78,7 @@ namespace VMAP
         int result = VMAP_LOAD_RESULT_IGNORED;
         if (isMapLoadingEnabled())
         {
+            ++iTileLoads;
             if (_loadMap(mapId, basePath, x, y))
                 result = VMAP_LOAD_RESULT_OK;
             else
@@ -122,6 +123,7 @@ namespace VMAP
 
     void VMapManager2::unloadMap(unsigned int mapId, int x, int y)
     {
+        ++iTileUnloads;
         InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(mapId);
         if (instanceTree != iInstanceMapTrees.end())
         {
@@ -261,45 +263,127 @@ namespace VMAP
         return false;
     }
 
+    ModelCacheShard& VMapManager2::getModelShard(const std::string& filename)
+    {
+        uint32 hash = 2166136261u;
+        for (std::string::const_iterator itr = filename.begin(); itr != filename.end(); ++itr)
+            hash = (hash ^ uint8(*itr)) * 16777619u;
+        return iModelShards[hash % MODEL_CACHE_SHARDS];
+    }
+
     WorldModel* VMapManager2::acquireModelInstance(const std::string& basepath, const std::string& filename)
     {
-        //! Critical section, thread safe access to iLoadedModelFiles
-        TRINITY_GUARD(ACE_Thread_Mutex, LoadedModelFilesLock);
+        ModelCacheShard& shard = getModelShard(filename);
+        //! Critical section, thread safe access to the models of this shard
+        TRINITY_GUARD(ACE_Thread_Mutex, shard.iLock);
 
-        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
-        if (model == iLoadedModelFiles.end())
+        ModelFileMap::iterator model = shard.iModels.find(filename);
+        if (model == shard.iModels.end())
         {
+            std::string fullname = basepath + filename + ".vmo";
             WorldModel* worldmodel = new WorldModel();
-            if (!worldmodel->readFile(basepath + filename + ".vmo"))
+            if (!worldmodel->readFile(fullname))
             {
                 sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: could not load '%s%s.vmo'", basepath.c_str(), filename.c_str());
                 delete worldmodel;
                 return NULL;
             }
             sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: loading file '%s%s'", basepath.c_str(), filename.c_str());
-            model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
-            model->second.setModel(worldmodel);
+
+            uint32 size = 0;
+            if (FILE* rf = fopen(fullname.c_str(), "rb"))
+            {
+                fseek(rf, 0, SEEK_END);
+                size = uint32(ftell(rf));
+                fclose(rf);
+            }
+
+            model = shard.iModels.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
+            model->second.setModel(worldmodel, size);
+            model->second.iUnusedItr = shard.iUnusedModels.end();
+            ++iModelLoads;
+            ++iResidentModels;
+            iResidentSize += long(size);
         }
-        model->second.incRefCount();
+
+        if (model->second.incRefCount() == 1 && model->second.iUnusedItr != shard.iUnusedModels.end())
+        {
+            // model was kept in cache after its last release
+            shard.iUnusedModels.erase(model->second.iUnusedItr);
+            shard.iUnusedSize -= model->second.getSize();
+            ++iModelCacheHits;
+        }
+        model->second.iUnusedItr = shard.iUnusedModels.end();
         return model->second.getModel();
     }
 
     void VMapManager2::releaseModelInstance(const std::string &filename)
     {
-        //! Critical section, thread safe access to iLoadedModelFiles
-        TRINITY_GUARD(ACE_Thread_Mutex, LoadedModelFilesLock);
+        ModelCacheShard& shard = getModelShard(filename);
+        //! Critical section, thread safe access to the models of this shard
+        TRINITY_GUARD(ACE_Thread_Mutex, shard.iLock);
 
-        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
-        if (model == iLoadedModelFiles.end())
+        ModelFileMap::iterator model = shard.iModels.find(filename);
+        if (model == shard.iModels.end())
         {
             sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: trying to unload non-loaded file '%s'", filename.c_str());
             return;
         }
         if (model->second.decRefCount() == 0)
         {
-            sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: unloading file '%s'", filename.c_str());
+            // keep it for the next tile load, least recently released models are unloaded first
+            model->second.iUnusedItr = shard.iUnusedModels.insert(shard.iUnusedModels.begin(), filename);
+            shard.iUnusedSize += model->second.getSize();
+            evictUnusedModels(shard);
+        }
+    }
+
+    void VMapManager2::evictUnusedModels(ModelCacheShard& shard)
+    {
+        uint64 budget = iUnusedModelCacheSize / MODEL_CACHE_SHARDS;
+        while (!shard.iUnusedModels.empty() && shard.iUnusedSize > budget)
+        {
+            ModelFileMap::iterator model = shard.iModels.find(shard.iUnusedModels.back());
+            shard.iUnusedModels.pop_back();
+            if (model == shard.iModels.end())
+                continue;
+
+            sLog->outDebug(LOG_FILTER_MAPS, "VMapManager2: unloading file '%s'", model->first.c_str());
+            shard.iUnusedSize -= model->second.getSize();
+            --iResidentModels;
+            iResidentSize -= long(model->second.getSize());
+            ++iModelEvictions;
             delete model->second.getModel();
-            iLoadedModelFiles.erase(model);
+            shard.iModels.erase(model);
+        }
+    }
+
+    void VMapManager2::setUnusedModelCacheSize(uint64 size)
+    {
+        iUnusedModelCacheSize = size;
+        for (uint32 shard = 0; shard < MODEL_CACHE_SHARDS; ++shard)
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, iModelShards[shard].iLock);
+            evictUnusedModels(iModelShards[shard]);
+        }
+    }
+
+    void VMapManager2::getStatistics(VMapStatistics& stats)
+    {
+        stats.modelLoads = iModelLoads.value();
+        stats.modelCacheHits = iModelCacheHits.value();
+        stats.modelEvictions = iModelEvictions.value();
+        stats.residentModels = iResidentModels.value();
+        stats.residentSize = iResidentSize.value();
+        stats.tileLoads = iTileLoads.value();
+        stats.tileUnloads = iTileUnloads.value();
+        stats.unusedModels = 0;
+        stats.unusedSize = 0;
+        for (uint32 shard = 0; shard < MODEL_CACHE_SHARDS; ++shard)
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, iModelShards[shard].iLock);
+            stats.unusedModels += long(iModelShards[shard].iUnusedModels.size());
+            stats.unusedSize += long(iModelShards[shard].iUnusedSize);
         }
     }
 
@@ -23,6 +23,8 @@
 #include "Dynamic/UnorderedMap.h"
 #include "Define.h"
 #include <ace/Thread_Mutex.h>
+#include <ace/Atomic_Op.h>
+#include <list>
 
 //===========================================================
 
@@ -30,6 +32,9 @@
 
 #define FILENAMEBUFFER_SIZE 500
 
+// model files are spread over this many independently locked caches
+#define MODEL_CACHE_SHARDS 16
+
 /**
 This is the main Class to manage loading and unloading of maps, line of sight, height calculation and so on.
 For each map or map tile to load it reads a directory file that contains the ModelContainer files used by this map or map tile.
@@ -50,30 +55,71 @@ namespace VMAP
     class StaticMapTree;
     class WorldModel;
 
+    typedef std::list<std::string> UnusedModelList;
+
     class ManagedModel
     {
         public:
-            ManagedModel() : iModel(0), iRefCount(0) { }
-            void setModel(WorldModel* model) { iModel = model; }
+            ManagedModel() : iModel(0), iRefCount(0), iSize(0) { }
+            void setModel(WorldModel* model, uint32 size) { iModel = model; iSize = size; }
             WorldModel* getModel() { return iModel; }
-            void incRefCount() { ++iRefCount; }
+            uint32 getSize() const { return iSize; }
+            int incRefCount() { return ++iRefCount; }
             int decRefCount() { return --iRefCount; }
+            //! position in the shard LRU list while no tile or gameobject uses the model
+            UnusedModelList::iterator iUnusedItr;
         protected:
             WorldModel* iModel;
             int iRefCount;
+            uint32 iSize;                                   // size of the .vmo file, used as estimate of resident memory
     };
 
     typedef UNORDERED_MAP<uint32, StaticMapTree*> InstanceTreeMap;
     typedef UNORDERED_MAP<std::string, ManagedModel> ModelFileMap;
 
+    struct ModelCacheShard
+    {
+        ModelCacheShard() : iUnusedSize(0) { }
+
+        ModelFileMap iModels;
+        //! unused models, most recently released first, kept until the cache budget is exceeded
+        UnusedModelList iUnusedModels;
+        uint64 iUnusedSize;
+        ACE_Thread_Mutex iLock;
+    };
+
+    struct VMapStatistics
+    {
+        long modelLoads;                                    // .vmo files read from disk
+        long modelCacheHits;                                // models reused from the unused model cache
+        long modelEvictions;                                // unused models unloaded to stay within cache budget
+        long residentModels;
+        long residentSize;                                  // bytes, estimated from file sizes
+        long unusedModels;
+        long unusedSize;
+        long tileLoads;
+        long tileUnloads;
+    };
+
     class VMapManager2 : public IVMapManager
     {
         protected:
             // Tree to check collision
-            ModelFileMap iLoadedModelFiles;
+            ModelCacheShard iModelShards[MODEL_CACHE_SHARDS];
             InstanceTreeMap iInstanceMapTrees;
-            // Mutex for iLoadedModelFiles
-            ACE_Thread_Mutex LoadedModelFilesLock;
+            // budget for models no longer referenced by any tile, per shard
+            uint64 iUnusedModelCacheSize;
+
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iModelLoads;
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iModelCacheHits;
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iModelEvictions;
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iResidentModels;
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iResidentSize;
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iTileLoads;
+            ACE_Atomic_Op<ACE_Thread_Mutex, long> iTileUnloads;
+
+            ModelCacheShard& getModelShard(const std::string& filename);
+            void evictUnusedModels(ModelCacheShard& shard);
 
             bool _loadMap(uint32 mapId, const std::string& basePath, uint32 tileX, uint32 tileY);
             /* void _unloadMap(uint32 pMapId, uint32 x, uint32 y); */
@@ -106,6 +152,10 @@ namespace VMAP
             WorldModel* acquireModelInstance(const std::string& basepath, const std::string& filename);
             void releaseModelInstance(const std::string& filename);
 
+            //! models released by all tiles stay loaded until their total size exceeds this, 0 unloads them at once
+            void setUnusedModelCacheSize(uint64 size);
+            void getStatistics(VMapStatistics& stats);
+
             // what's the use of this? o.O
             virtual std::string getDirFileName(unsigned int mapId, int /*x*/, int /*y*/) const
             {
@@ -21,6 +21,11 @@
 #include "VMapDefinitions.h"
 #include "MapTree.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define VMAP_SSE2_TRIANGLES
+#endif
+
 using G3D::Vector3;
 using G3D::Ray;
 
@@ -80,6 +85,115 @@ namespace VMAP
         return false;
     }
 
+    /* Triangle cache layout: 9 arrays (v0.xyz, e1.xyz, e2.xyz) of triangles.size() + TRIANGLE_CACHE_PADDING floats,
+       so 4 triangles following each other in a BIH leaf can be loaded at once, even at the end of the arrays. */
+    enum TriangleCacheComponent
+    {
+        TC_V0_X, TC_V0_Y, TC_V0_Z,
+        TC_E1_X, TC_E1_Y, TC_E1_Z,
+        TC_E2_X, TC_E2_Y, TC_E2_Z,
+        TC_COMPONENT_COUNT
+    };
+
+    #define TRIANGLE_CACHE_PADDING 3
+
+    // Same algorithm as IntersectTriangle, for count triangles stored at position in the triangle cache
+    bool IntersectTriangles(const float* cache, uint32 stride, uint32 position, uint32 count, const G3D::Ray &ray, float &distance)
+    {
+        static const float EPS = 1e-5f;
+
+        const Vector3& org = ray.origin();
+        const Vector3& dir = ray.direction();
+        bool hit = false;
+
+#ifdef VMAP_SSE2_TRIANGLES
+        const __m128 eps = _mm_set1_ps(EPS);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 dx = _mm_set1_ps(dir.x), dy = _mm_set1_ps(dir.y), dz = _mm_set1_ps(dir.z);
+        const __m128 ox = _mm_set1_ps(org.x), oy = _mm_set1_ps(org.y), oz = _mm_set1_ps(org.z);
+
+        for (uint32 i = 0; i < count; i += 4)
+        {
+            const float* c = cache + position + i;
+            const __m128 v0x = _mm_loadu_ps(c + TC_V0_X * stride), v0y = _mm_loadu_ps(c + TC_V0_Y * stride), v0z = _mm_loadu_ps(c + TC_V0_Z * stride);
+            const __m128 e1x = _mm_loadu_ps(c + TC_E1_X * stride), e1y = _mm_loadu_ps(c + TC_E1_Y * stride), e1z = _mm_loadu_ps(c + TC_E1_Z * stride);
+            const __m128 e2x = _mm_loadu_ps(c + TC_E2_X * stride), e2y = _mm_loadu_ps(c + TC_E2_Y * stride), e2z = _mm_loadu_ps(c + TC_E2_Z * stride);
+
+            // p = dir x e2, a = e1 . p
+            const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+            const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+            const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+            const __m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+            __m128 mask = _mm_cmpge_ps(_mm_andnot_ps(signMask, a), eps);
+
+            const __m128 f = _mm_div_ps(one, a);
+            const __m128 sx = _mm_sub_ps(ox, v0x), sy = _mm_sub_ps(oy, v0y), sz = _mm_sub_ps(oz, v0z);
+            const __m128 u = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)));
+            mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+            // q = s x e1
+            const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+            const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+            const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+            const __m128 v = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)));
+            mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+            const __m128 t = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)));
+            mask = _mm_and_ps(mask, _mm_cmpgt_ps(t, zero));
+
+            int lanes = _mm_movemask_ps(mask);
+            if (count - i < 4)
+                lanes &= (1 << (count - i)) - 1;
+            if (!lanes)
+                continue;
+
+            float tValues[4];
+            _mm_storeu_ps(tValues, t);
+            for (uint32 lane = 0; lane < 4; ++lane)
+            {
+                if ((lanes & (1 << lane)) && tValues[lane] < distance)
+                {
+                    distance = tValues[lane];
+                    hit = true;
+                }
+            }
+        }
+#else
+        for (uint32 i = position; i < position + count; ++i)
+        {
+            const Vector3 v0(cache[TC_V0_X * stride + i], cache[TC_V0_Y * stride + i], cache[TC_V0_Z * stride + i]);
+            const Vector3 e1(cache[TC_E1_X * stride + i], cache[TC_E1_Y * stride + i], cache[TC_E1_Z * stride + i]);
+            const Vector3 e2(cache[TC_E2_X * stride + i], cache[TC_E2_Y * stride + i], cache[TC_E2_Z * stride + i]);
+
+            const Vector3 p(dir.cross(e2));
+            const float a = e1.dot(p);
+            if (fabs(a) < EPS)
+                continue;
+
+            const float f = 1.0f / a;
+            const Vector3 s(org - v0);
+            const float u = f * s.dot(p);
+            if ((u < 0.0f) || (u > 1.0f))
+                continue;
+
+            const Vector3 q(s.cross(e1));
+            const float v = f * dir.dot(q);
+            if ((v < 0.0f) || ((u + v) > 1.0f))
+                continue;
+
+            const float t = f * e2.dot(q);
+            if ((t > 0.0f) && (t < distance))
+            {
+                distance = t;
+                hit = true;
+            }
+        }
+#endif
+        return hit;
+    }
+
     class TriBoundFunc
     {
         public:
@@ -253,7 +367,8 @@ namespace VMAP
 
     GroupModel::GroupModel(const GroupModel &other):
         iBound(other.iBound), iMogpFlags(other.iMogpFlags), iGroupWMOID(other.iGroupWMOID),
-        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(0)
+        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(0),
+        triangleCache(other.triangleCache)
     {
         if (other.iLiquid)
             iLiquid = new WmoLiquid(*other.iLiquid);
@@ -265,6 +380,30 @@ namespace VMAP
         triangles.swap(tri);
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
+        buildTriangleCache();
+    }
+
+    void GroupModel::buildTriangleCache()
+    {
+        triangleCache.clear();
+        if (triangles.empty() || meshTree.primCount() != triangles.size())
+            return;
+
+        uint32 stride = triangles.size() + TRIANGLE_CACHE_PADDING;
+        triangleCache.resize(TC_COMPONENT_COUNT * stride, 0.0f);
+        for (uint32 i = 0; i < triangles.size(); ++i)
+        {
+            const MeshTriangle& tri = triangles[meshTree.primAt(i)];
+            const Vector3& v0 = vertices[tri.idx0];
+            const Vector3 e1 = vertices[tri.idx1] - v0;
+            const Vector3 e2 = vertices[tri.idx2] - v0;
+            for (uint8 axis = 0; axis < 3; ++axis)
+            {
+                triangleCache[(TC_V0_X + axis) * stride + i] = v0[axis];
+                triangleCache[(TC_E1_X + axis) * stride + i] = e1[axis];
+                triangleCache[(TC_E2_X + axis) * stride + i] = e2[axis];
+            }
+        }
     }
 
     bool GroupModel::writeToFile(FILE* wf)
@@ -347,6 +486,7 @@ namespace VMAP
         // read mesh BIH
         if (result && !readChunk(rf, chunk, "MBIH", 4)) result = false;
         if (result) result = meshTree.readFromFile(rf);
+        if (result) buildTriangleCache();
 
         // write liquid data
         if (result && !readChunk(rf, chunk, "LIQU", 4)) result = false;
@@ -372,11 +512,35 @@ namespace VMAP
         bool hit;
     };
 
+    // tests all triangles of a mesh BIH leaf at once
+    struct GModelLeafRayCallback
+    {
+        GModelLeafRayCallback(const std::vector<float> &cache, uint32 triangleCount):
+            cache(&cache[0]), stride(triangleCount + TRIANGLE_CACHE_PADDING), hit(false) { }
+        bool operator()(const G3D::Ray& ray, uint32 position, uint32 count, float& distance, bool /*pStopAtFirstHit*/)
+        {
+            if (IntersectTriangles(cache, stride, position, count, ray, distance))
+                hit = true;
+            return hit;
+        }
+
+        const float* cache;
+        uint32 stride;
+        bool hit;
+    };
+
     bool GroupModel::IntersectRay(const G3D::Ray &ray, float &distance, bool stopAtFirstHit) const
     {
         if (triangles.empty())
             return false;
 
+        if (!triangleCache.empty())
+        {
+            GModelLeafRayCallback callback(triangleCache, triangles.size());
+            meshTree.intersectRayLeaves(ray, callback, distance, stopAtFirstHit);
+            return callback.hit;
+        }
+
         GModelRayCallback callback(triangles, vertices);
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
         return callback.hit;
@@ -100,6 +100,10 @@ namespace VMAP
             std::vector<MeshTriangle> triangles;
             BIH meshTree;
             WmoLiquid* iLiquid;
+            //! first vertex and both edges of every triangle, component arrays in meshTree leaf order, see buildTriangleCache()
+            std::vector<float> triangleCache;
+
+            void buildTriangleCache();
         public:
             void getMeshData(std::vector<G3D::Vector3> &vertices, std::vector<MeshTriangle> &triangles, WmoLiquid* &liquid);
     };
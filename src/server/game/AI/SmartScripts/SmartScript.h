@@ -219,6 +219,8 @@ class SmartScript
         void SetPhase(uint32 p = 0) { mEventPhase = p; }
 
         SmartAIEventList mEvents;
+        // positions in mEvents by event type, firing an event only visits the holders listening to it
+        std::vector<uint32> mEventIndex[SMART_EVENT_END];
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         Creature* me;
@@ -242,6 +244,8 @@ class SmartScript
 
         SMARTAI_TEMPLATE mTemplate;
         void InstallEvents();
+        void AddEvent(SmartScriptHolder const& e);
+        static bool IsTimedEvent(uint32 eventType);
 
         void RemoveStoredEvent (uint32 id)
         {
@@ -238,6 +238,24 @@ void SmartAIMgr::LoadSmartAIFromDB()
 
 }
 
+void SmartAIMgr::AddExecStat(int32 entryOrGuid, uint32 sourceType)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, mExecStatsLock);
+    ++mExecStats[MAKE_PAIR64(entryOrGuid, sourceType)];
+}
+
+void SmartAIMgr::ResetExecStats()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, mExecStatsLock);
+    mExecStats.clear();
+}
+
+void SmartAIMgr::GetExecStats(SmartScriptExecStatMap& stats)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, mExecStatsLock);
+    stats = mExecStats;
+}
+
 bool SmartAIMgr::IsTargetValid(SmartScriptHolder const& e)
 {
     if (e.GetActionType() == SMART_ACTION_INSTALL_AI_TEMPLATE)
@@ -1307,15 +1307,25 @@ typedef std::vector<SmartScriptHolder> SmartAIEventList;
 // all events for all entries / guids
 typedef UNORDERED_MAP<int32, SmartAIEventList> SmartAIEventMap;
 
+// executed actions per entryOrGuid and source type, collected only while enabled by .debug smartstats
+typedef UNORDERED_MAP<uint64, uint64> SmartScriptExecStatMap;
+
 class SmartAIMgr
 {
     friend class ACE_Singleton<SmartAIMgr, ACE_Null_Mutex>;
-    SmartAIMgr(){};
+    SmartAIMgr() : mExecStatsEnabled(false) {};
     public:
         ~SmartAIMgr(){};
 
         void LoadSmartAIFromDB();
 
+        // Execution statistics
+        bool IsExecStatsEnabled() const { return mExecStatsEnabled; }
+        void SetExecStatsEnabled(bool enabled) { mExecStatsEnabled = enabled; }
+        void AddExecStat(int32 entryOrGuid, uint32 sourceType);
+        void ResetExecStats();
+        void GetExecStats(SmartScriptExecStatMap& stats);
+
         SmartAIEventList GetScript(int32 entry, SmartScriptType type)
         {
             SmartAIEventList temp;
@@ -1333,6 +1343,10 @@ class SmartAIMgr
         //event stores
         SmartAIEventMap mEventMap[SMART_SCRIPT_TYPE_MAX];
 
+        bool mExecStatsEnabled;
+        SmartScriptExecStatMap mExecStats;
+        ACE_Thread_Mutex mExecStatsLock;
+
         bool IsEventValid(SmartScriptHolder& e);
         bool IsTargetValid(SmartScriptHolder const& e);
 
@@ -1401,7 +1401,9 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes type,
     if (IsGuild<T>() && !sWorld->getBoolConfig(CONFIG_GUILD_LEVELING_ENABLED))
         return;
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type, IsGuild<T>());
+    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type, miscValue1, IsGuild<T>());
+    uint32 checked = 0;
+    uint32 skippedCompleted = 0;
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
@@ -1409,6 +1411,14 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes type,
         if (!achievement)
             continue;
 
+        // criteria of a completed achievement can't complete anything anymore, unless another achievement is built on them
+        if (!(achievement->flags & ACHIEVEMENT_FLAG_COUNTER) && HasAchieved(achievement->ID) && !sAchievementMgr->GetAchievementByReferencedId(achievement->ID))
+        {
+            ++skippedCompleted;
+            continue;
+        }
+
+        ++checked;
         if (!CanUpdateCriteria(achievementCriteria, achievement, miscValue1, miscValue2, miscValue3, unit, referencePlayer))
             continue;
 
@@ -1733,6 +1743,12 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes type,
                 if (IsCompletedAchievement(*itr))
                     CompletedAchievement(*itr, referencePlayer);   
     }
+
+    if (sAchievementMgr->IsUpdateStatsEnabled())
+    {
+        uint32 skippedByAsset = sAchievementMgr->GetAchievementCriteriaByType(type, IsGuild<T>()).size() - achievementCriteriaList.size();
+        sAchievementMgr->AddUpdateStat(type, checked, skippedByAsset, skippedCompleted);
+    }
 }
 
 template<class T>
@@ -4006,6 +4022,16 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
         else
             ++criterias, m_AchievementCriteriasByType[criteria->type].push_back(criteria);
 
+        uint32 asset;
+        if (GetCriteriaAsset(criteria, asset))
+        {
+            m_criteriaTypeByAsset[criteria->type] = true;
+            if (achievement && achievement->flags & ACHIEVEMENT_FLAG_GUILD)
+                m_GuildAchievementCriteriasByAsset[criteria->type][asset].push_back(criteria);
+            else
+                m_AchievementCriteriasByAsset[criteria->type][asset].push_back(criteria);
+        }
+
         if (criteria->timeLimit)
             m_AchievementCriteriasByTimedType[criteria->timedCriteriaStartType].push_back(criteria);
     }
@@ -4013,6 +4039,129 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u achievement criteria and %u guild achievement crieteria in %u ms", criterias, guildCriterias, GetMSTimeDiffToNow(oldMSTime));
 }
 
+AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteriaByType(AchievementCriteriaTypes type, uint64 miscValue1, bool guild) const
+{
+    if (!miscValue1 || !m_criteriaTypeByAsset[type])
+        return GetAchievementCriteriaByType(type, guild);
+
+    static AchievementCriteriaEntryList const emptyList;
+
+    AchievementCriteriaListByAsset const& byAsset = guild ? m_GuildAchievementCriteriasByAsset[type] : m_AchievementCriteriasByAsset[type];
+    AchievementCriteriaListByAsset::const_iterator itr = byAsset.find(uint32(miscValue1));
+    if (itr == byAsset.end() || itr->first != miscValue1)
+        return emptyList;
+
+    return itr->second;
+}
+
+bool AchievementGlobalMgr::GetCriteriaAsset(AchievementCriteriaEntry const* criteria, uint32& asset)
+{
+    // must match the miscValue1 checks of AchievementMgr::RequirementsSatisfied
+    switch (AchievementCriteriaTypes(criteria->type))
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+            asset = criteria->kill_creature.creatureID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+            asset = criteria->reach_skill_level.skillID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+            asset = criteria->learn_skill_level.skillID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+            asset = criteria->complete_quests_in_zone.zoneID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+            asset = criteria->killed_by_creature.creatureEntry;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+            asset = criteria->complete_quest.questID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+            asset = criteria->be_spell_target.spellID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+            asset = criteria->cast_spell.spellID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+            asset = criteria->learn_spell.spellID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+            asset = criteria->own_item.itemID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+            asset = criteria->use_item.itemID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+            asset = criteria->gain_reputation.factionID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+            asset = criteria->do_emote.emoteID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+            asset = criteria->equip_item.itemID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+            asset = criteria->use_gameobject.goEntry;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+            asset = criteria->fish_in_gameobject.goEntry;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+            asset = criteria->learn_skillline_spell.skillLine;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+            asset = criteria->learn_skill_line.skillLine;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+            asset = criteria->hk_class.classID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+            asset = criteria->hk_race.raceID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+            asset = criteria->bg_objective.objectiveId;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+            asset = criteria->honorable_kill_at_area.areaID;
+            return true;
+        case ACHIEVEMENT_CRITERIA_TYPE_CURRENCY:
+            asset = criteria->currencyGain.currency;
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
+
+void AchievementGlobalMgr::AddUpdateStat(AchievementCriteriaTypes type, uint32 checked, uint32 skippedByAsset, uint32 skippedCompleted)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_updateStatsLock);
+    AchievementCriteriaUpdateStat& stat = m_updateStats[type];
+    ++stat.Calls;
+    stat.Checked += checked;
+    stat.SkippedByAsset += skippedByAsset;
+    stat.SkippedCompleted += skippedCompleted;
+}
+
+void AchievementGlobalMgr::ResetUpdateStats()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_updateStatsLock);
+    for (uint32 i = 0; i < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++i)
+        m_updateStats[i] = AchievementCriteriaUpdateStat();
+}
+
+void AchievementGlobalMgr::GetUpdateStats(AchievementCriteriaUpdateStat* stats)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_updateStatsLock);
+    for (uint32 i = 0; i < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++i)
+        stats[i] = m_updateStats[i];
+}
+
 void AchievementGlobalMgr::LoadAchievementReferenceList()
 {
     uint32 oldMSTime = getMSTime();
@@ -33,6 +33,18 @@ typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
 typedef ACE_Based::LockedMap<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
 typedef ACE_Based::LockedMap<uint32, AchievementEntryList>         AchievementListByReferencedId;
+typedef UNORDERED_MAP<uint32, AchievementCriteriaEntryList>        AchievementCriteriaListByAsset;
+
+// UpdateAchievementCriteria work per criteria type, collected only while enabled by .debug achievementstats
+struct AchievementCriteriaUpdateStat
+{
+    AchievementCriteriaUpdateStat() : Calls(0), Checked(0), SkippedByAsset(0), SkippedCompleted(0) {}
+
+    uint64 Calls;
+    uint64 Checked;                                         // criteria that went through CanUpdateCriteria
+    uint64 SkippedByAsset;                                  // criteria of the type left out by the asset index
+    uint64 SkippedCompleted;                                // criteria of already completed achievements
+};
 
 struct CriteriaProgress
 {
@@ -279,7 +291,7 @@ class AchievementMgr
 class AchievementGlobalMgr
 {
         friend class ACE_Singleton<AchievementGlobalMgr, ACE_Null_Mutex>;
-        AchievementGlobalMgr() {}
+        AchievementGlobalMgr() : m_updateStatsEnabled(false) { memset(m_criteriaTypeByAsset, 0, sizeof(m_criteriaTypeByAsset)); }
         ~AchievementGlobalMgr() {}
 
     public:
@@ -291,6 +303,12 @@ class AchievementGlobalMgr
             return guild ? m_GuildAchievementCriteriasByType[type] : m_AchievementCriteriasByType[type];
         }
 
+        // criteria of the type that can progress for miscValue1, see GetCriteriaAsset
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByType(AchievementCriteriaTypes type, uint64 miscValue1, bool guild) const;
+
+        // asset (creature, item, quest, spell...) a criteria requires miscValue1 to match whenever miscValue1 is set, false for other types
+        static bool GetCriteriaAsset(AchievementCriteriaEntry const* criteria, uint32& asset);
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -363,6 +381,13 @@ class AchievementGlobalMgr
         AchievementEntry const* GetAchievement(uint32 achievementId) const;
         AchievementCriteriaEntry const* GetAchievementCriteria(uint32 achievementId) const;
 
+        // Criteria update statistics
+        bool IsUpdateStatsEnabled() const { return m_updateStatsEnabled; }
+        void SetUpdateStatsEnabled(bool enabled) { m_updateStatsEnabled = enabled; }
+        void AddUpdateStat(AchievementCriteriaTypes type, uint32 checked, uint32 skippedByAsset, uint32 skippedCompleted);
+        void ResetUpdateStats();
+        void GetUpdateStats(AchievementCriteriaUpdateStat* stats);
+
     private:
         AchievementCriteriaDataMap m_criteriaDataMap;
 
@@ -370,6 +395,11 @@ class AchievementGlobalMgr
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
         AchievementCriteriaEntryList m_GuildAchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
 
+        // same criterias by type and asset, for the types GetCriteriaAsset knows
+        bool m_criteriaTypeByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaListByAsset m_AchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaListByAsset m_GuildAchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
 
         // store achievement criterias by achievement to speed up lookup
@@ -383,6 +413,10 @@ class AchievementGlobalMgr
 
         AchievementRewards m_achievementRewards;
         AchievementRewardLocales m_achievementRewardLocales;
+
+        bool m_updateStatsEnabled;
+        AchievementCriteriaUpdateStat m_updateStats[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        ACE_Thread_Mutex m_updateStatsLock;
 };
 
 #define sAchievementMgr ACE_Singleton<AchievementGlobalMgr, ACE_Null_Mutex>::instance()
@@ -37,12 +37,14 @@ enum eAuctionHouse
     AH_MINIMUM_DEPOSIT = 100,
 };
 
-AuctionHouseMgr::AuctionHouseMgr()
+AuctionHouseMgr::AuctionHouseMgr() : _searchTick(0)
 {
 }
 
 AuctionHouseMgr::~AuctionHouseMgr()
 {
+    DeactivateSearchThreads();
+
     for (ItemMap::iterator itr = mAitems.begin(); itr != mAitems.end(); ++itr)
         delete itr->second;
 }
@@ -377,6 +379,58 @@ void AuctionHouseMgr::Update()
     mNeutralAuctions.Update();
 }
 
+void AuctionHouseMgr::ActivateSearchThreads(uint32 threads)
+{
+    if (!threads || _searchExecutor.activate(threads) == -1)
+        return;
+
+    // auctions already loaded need their search records too
+    AuctionHouseObject* houses[] = { &mHordeAuctions, &mAllianceAuctions, &mNeutralAuctions };
+    for (uint8 i = 0; i < 3; ++i)
+        for (AuctionHouseObject::AuctionEntryMap::iterator itr = houses[i]->GetAuctionsBegin(); itr != houses[i]->GetAuctionsEnd(); ++itr)
+            houses[i]->UpdateSearchRecord(itr->second);
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Started %u auction house search threads", threads);
+}
+
+void AuctionHouseMgr::DeactivateSearchThreads()
+{
+    if (_searchExecutor.activated())
+        _searchExecutor.deactivate();
+
+    AuctionSearchResult* result;
+    while (_searchResults.next(result))
+        delete result;
+}
+
+bool AuctionHouseMgr::QueueSearch(AuctionHouseObject* auctionHouse, AuctionSearchQuery const& query)
+{
+    if (!IsSearchThreaded())
+        return false;
+
+    // records only have names for some locales, other name searches stay in the world thread
+    if (!query.SearchedName.empty() && !IsThreadedSearchLocale(query.Locale))
+        return false;
+
+    return _searchExecutor.execute(new AuctionSearchRequest(query, auctionHouse->GetSearchSnapshot())) != -1;
+}
+
+void AuctionHouseMgr::SendSearchResults()
+{
+    ++_searchTick;
+
+    AuctionSearchResult* result;
+    while (_searchResults.next(result))
+    {
+        // the player may have logged out while the search was running
+        if (WorldSession* session = sWorld->FindSession(result->AccountId))
+            if (session->GetPlayer())
+                session->SendPacket(&result->Packet);
+
+        delete result;
+    }
+}
+
 AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(uint32 factionTemplateId)
 {
     uint32 houseid = 7; // goblin auction house
@@ -422,12 +476,17 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     AuctionsMap[auction->Id] = auction;
+    AddToSearchIndex(auction);
+    UpdateSearchRecord(auction);
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction, uint32 /*itemEntry*/)
 {
     bool wasInMap = AuctionsMap.erase(auction->Id) ? true : false;
+    RemoveFromSearchIndex(auction);
+    if (SearchRecords.erase(auction->Id))
+        SearchSnapshotDirty = true;
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -436,6 +495,37 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction, uint32 /*itemEntry
     return wasInMap;
 }
 
+void AuctionHouseObject::UpdateSearchRecord(AuctionEntry* auction)
+{
+    if (!sAuctionMgr->IsSearchThreaded())
+        return;
+
+    if (Item* item = sAuctionMgr->GetAItem(auction->itemGUIDLow))
+        SearchRecords[auction->Id] = AuctionSearchRecordPtr(new AuctionSearchRecord(auction, item));
+    else
+        SearchRecords.erase(auction->Id);
+
+    SearchSnapshotDirty = true;
+}
+
+AuctionSearchSnapshotPtr AuctionHouseObject::GetSearchSnapshot()
+{
+    // a snapshot only copies record pointers, but with busy houses it would still be rebuilt for nearly every
+    // search, so it is rebuilt at most once per world tick and picks up all changes of the previous ticks
+    if (SearchSnapshot && (!SearchSnapshotDirty || SearchSnapshotTick == sAuctionMgr->GetSearchTick()))
+        return SearchSnapshot;
+
+    AuctionSearchSnapshot* snapshot = new AuctionSearchSnapshot();
+    snapshot->reserve(SearchRecords.size());
+    for (std::map<uint32, AuctionSearchRecordPtr>::const_iterator itr = SearchRecords.begin(); itr != SearchRecords.end(); ++itr)
+        snapshot->push_back(itr->second);
+
+    SearchSnapshot = AuctionSearchSnapshotPtr(snapshot);
+    SearchSnapshotDirty = false;
+    SearchSnapshotTick = sAuctionMgr->GetSearchTick();
+    return SearchSnapshot;
+}
+
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld->GetGameTime();
@@ -445,17 +535,15 @@ void AuctionHouseObject::Update()
     if (AuctionsMap.empty())
         return;
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_AUCTION_BY_TIME);
-    stmt->setUInt32(0, (uint32)curTime+60);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-        return;
+    // expire times are all in memory, no need to ask the database (synchronously) which auctions ended
+    std::multimap<time_t, uint32> expired;
+    for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
+        if (itr->second->expire_time <= curTime + 60)
+            expired.insert(std::make_pair(itr->second->expire_time, itr->first));
 
-    do
+    for (std::multimap<time_t, uint32>::const_iterator itr = expired.begin(); itr != expired.end(); ++itr)
     {
-        // from auctionhousehandler.cpp, creates auction pointer & player pointer
-        AuctionEntry* auction = GetAuction(result->Fetch()->GetUInt32());
+        AuctionEntry* auction = GetAuction(itr->second);
 
         if (!auction)
             continue;
@@ -488,7 +576,6 @@ void AuctionHouseObject::Update()
         sAuctionMgr->RemoveAItem(auction->itemGUIDLow);
         RemoveAuction(auction, itemEntry);
     }
-    while (result->NextRow());
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
@@ -521,6 +608,55 @@ void AuctionHouseObject::BuildListOwnerItems(WorldPacket& data, Player* player,
     }
 }
 
+void AuctionHouseObject::AddToSearchIndex(AuctionEntry* auction)
+{
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->itemEntry);
+    if (!proto)
+        return;
+
+    AuctionsByClass[proto->Class][auction->Id] = auction;
+    AuctionsBySubClass[MAKE_PAIR32(proto->SubClass, proto->Class)][auction->Id] = auction;
+}
+
+void AuctionHouseObject::RemoveFromSearchIndex(AuctionEntry* auction)
+{
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->itemEntry);
+    if (!proto)
+        return;
+
+    AuctionIndexMap::iterator itr = AuctionsByClass.find(proto->Class);
+    if (itr != AuctionsByClass.end())
+    {
+        itr->second.erase(auction->Id);
+        if (itr->second.empty())
+            AuctionsByClass.erase(itr);
+    }
+
+    itr = AuctionsBySubClass.find(MAKE_PAIR32(proto->SubClass, proto->Class));
+    if (itr != AuctionsBySubClass.end())
+    {
+        itr->second.erase(auction->Id);
+        if (itr->second.empty())
+            AuctionsBySubClass.erase(itr);
+    }
+}
+
+std::wstring const& AuctionHouseObject::GetSearchName(AuctionEntry* auction, Item* item, int locIdx, int locDbcIdx) const
+{
+    AuctionSearchName& searchName = auction->searchName;
+    int32 locale = (locIdx + 1) * (TOTAL_LOCALES + 1) + locDbcIdx + 1;
+    if (searchName.Locale == locale)
+        return searchName.Name;
+
+    searchName.Locale = locale;
+
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
+    //  that matches the search but it may not equal item->GetItemRandomPropertyId()
+    //  used in BuildAuctionInfo() which then causes wrong items to be listed
+    BuildAuctionSearchName(item->GetTemplate(), item->GetItemRandomPropertyId(), locIdx, locDbcIdx, searchName.Name);
+    return searchName.Name;
+}
+
 void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player,
     std::wstring const& wsearchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
     uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
@@ -529,7 +665,20 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
     int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
     int locdbc_idx = player->GetSession()->GetSessionDbcLocale();
 
-    for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
+    // only walk the auctions of the searched class/subclass, the index keeps them in AuctionsMap order so paging is unchanged
+    AuctionEntryMap const* auctions = &AuctionsMap;
+    if (itemClass != 0xffffffff)
+    {
+        AuctionIndexMap::const_iterator itr = itemSubClass != 0xffffffff
+            ? AuctionsBySubClass.find(MAKE_PAIR32(itemSubClass, itemClass))
+            : AuctionsByClass.find(itemClass);
+        if (itr == (itemSubClass != 0xffffffff ? AuctionsBySubClass.end() : AuctionsByClass.end()))
+            return;
+
+        auctions = &itr->second;
+    }
+
+    for (AuctionEntryMap::const_iterator itr = auctions->begin(); itr != auctions->end(); ++itr)
     {
         AuctionEntry* Aentry = itr->second;
         Item* item = sAuctionMgr->GetAItem(Aentry->itemGUIDLow);
@@ -560,45 +709,8 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
         // No need to do any of this if no search term was entered
         if (!wsearchedname.empty())
         {
-            std::string name = proto->Name1;
-            if (name.empty())
-                continue;
-
-            // local name
-            if (loc_idx >= 0)
-                if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
-                    ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
-
-            // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-            //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-            //  used in BuildAuctionInfo() which then causes wrong items to be listed
-            int32 propRefID = item->GetItemRandomPropertyId();
-
-            if (propRefID)
-            {
-                // Append the suffix to the name (ie: of the Monkey) if one exists
-                // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
-                //  even though the DBC names seem misleading
-                const ItemRandomPropertiesEntry* itemRandProp = sItemRandomPropertiesStore.LookupEntry(propRefID);
-
-                if (itemRandProp)
-                {
-                    char* temp = itemRandProp->nameSuffix;
-                    //char* temp = itemRandProp->nameSuffix;
-
-                    // dbc local name
-                    if (temp)
-                    {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += temp[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
-                    }
-                }
-            }
-
-            // Perform the search (with or without suffix)
-            if (!Utf8FitTo(name, wsearchedname))
+            // Perform the search (with or without suffix), the lower case name is built once per auction and locale
+            if (GetSearchName(Aentry, item, loc_idx, locdbc_idx).find(wsearchedname) == std::wstring::npos)
                 continue;
         }
 
@@ -613,7 +725,7 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
 }
 
 //this function inserts to WorldPacket auction's data
-bool AuctionEntry::BuildAuctionInfo(WorldPacket& data) const
+bool AuctionEntry::BuildAuctionInfo(ByteBuffer& data, size_t* timeLeftPos /*= NULL*/) const
 {
     Item* item = sAuctionMgr->GetAItem(itemGUIDLow);
     if (!item)
@@ -642,6 +754,8 @@ bool AuctionEntry::BuildAuctionInfo(WorldPacket& data) const
     data << uint64(bid ? GetAuctionOutBid() : 0);
     // Minimal outbid
     data << uint64(buyout);                                         // Auction->buyout
+    if (timeLeftPos)
+        *timeLeftPos = data.wpos();
     data << uint32((expire_time - time(NULL)) * IN_MILLISECONDS);   // time left
     data << uint64(MAKE_NEW_GUID(bidder, 0, HIGHGUID_PLAYER));      // auction->bidder current
     data << uint64(bid);                                            // current bid
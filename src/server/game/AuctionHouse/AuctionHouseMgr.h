@@ -24,6 +24,9 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "DBCStructure.h"
+#include "DelayExecutor.h"
+#include "LockedQueue.h"
+#include "AuctionHouseSearch.h"
 
 class Item;
 class Player;
@@ -63,6 +66,15 @@ enum MailAuctionAnswers
     AUCTION_SALE_PENDING        = 6
 };
 
+// lower case item name with random suffix, as matched by auction browse name searches
+struct AuctionSearchName
+{
+    AuctionSearchName() : Locale(-1) {}
+
+    std::wstring Name;
+    int32 Locale;                                           // db and dbc locale the name was built for, -1 if not built yet
+};
+
 struct AuctionEntry
 {
     uint32 Id;
@@ -79,13 +91,14 @@ struct AuctionEntry
     uint32 deposit;                                         //deposit can be calculated only when creating auction
     AuctionHouseEntry const* auctionHouseEntry;             // in AuctionHouse.dbc
     uint32 factionTemplateId;
+    AuctionSearchName searchName;
 
     // helpers
     uint32 GetHouseId() const { return auctionHouseEntry->houseId; }
     uint32 GetHouseFaction() const { return auctionHouseEntry->faction; }
     uint32 GetAuctionCut() const;
     uint32 GetAuctionOutBid() const;
-    bool BuildAuctionInfo(WorldPacket & data) const;
+    bool BuildAuctionInfo(ByteBuffer& data, size_t* timeLeftPos = NULL) const;
     void DeleteFromDB(SQLTransaction& trans) const;
     void SaveToDB(SQLTransaction& trans) const;
     bool LoadFromDB(Field* fields);
@@ -100,7 +113,7 @@ class AuctionHouseObject
 {
   public:
     // Initialize storage
-    AuctionHouseObject() { next = AuctionsMap.begin(); }
+    AuctionHouseObject() : SearchSnapshotDirty(true), SearchSnapshotTick(0) { next = AuctionsMap.begin(); }
     ~AuctionHouseObject()
     {
         for (AuctionEntryMap::iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
@@ -108,6 +121,7 @@ class AuctionHouseObject
     }
 
     typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
+    typedef UNORDERED_MAP<uint32, AuctionEntryMap> AuctionIndexMap;
 
     uint32 Getcount() const { return AuctionsMap.size(); }
 
@@ -124,6 +138,10 @@ class AuctionHouseObject
 
     bool RemoveAuction(AuctionEntry* auction, uint32 itemEntry);
 
+    // must be called whenever a listed auction changes (bids), keeps threaded browse searches up to date
+    void UpdateSearchRecord(AuctionEntry* auction);
+    AuctionSearchSnapshotPtr GetSearchSnapshot();
+
     void Update();
 
     void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
@@ -134,8 +152,22 @@ class AuctionHouseObject
         uint32& count, uint32& totalcount);
 
   private:
+    void AddToSearchIndex(AuctionEntry* auction);
+    void RemoveFromSearchIndex(AuctionEntry* auction);
+    std::wstring const& GetSearchName(AuctionEntry* auction, Item* item, int locIdx, int locDbcIdx) const;
+
     AuctionEntryMap AuctionsMap;
 
+    // browse search index, same auctions as AuctionsMap (and in the same order) split by item class and by item class/subclass
+    AuctionIndexMap AuctionsByClass;
+    AuctionIndexMap AuctionsBySubClass;
+
+    // records for threaded browse searches, only kept while search threads are running
+    std::map<uint32, AuctionSearchRecordPtr> SearchRecords;
+    AuctionSearchSnapshotPtr SearchSnapshot;
+    bool SearchSnapshotDirty;
+    uint32 SearchSnapshotTick;                              // AuctionHouseMgr::GetSearchTick when SearchSnapshot was built
+
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator next;
 };
@@ -189,7 +221,21 @@ class AuctionHouseMgr
 
         void Update();
 
+        // browse searches served by worker threads from auction snapshots
+        void ActivateSearchThreads(uint32 threads);
+        void DeactivateSearchThreads();
+        bool IsSearchThreaded() { return _searchExecutor.activated(); }
+        bool QueueSearch(AuctionHouseObject* auctionHouse, AuctionSearchQuery const& query);
+        void AddSearchResult(AuctionSearchResult* result) { _searchResults.add(result); }
+        // called every world tick, also starts a new tick for the search snapshots
+        void SendSearchResults();
+        uint32 GetSearchTick() const { return _searchTick; }
+
     private:
+        uint32 _searchTick;
+
+        DelayExecutor _searchExecutor;
+        ACE_Based::LockedQueue<AuctionSearchResult*, ACE_Thread_Mutex> _searchResults;
 
         AuctionHouseObject mHordeAuctions;
         AuctionHouseObject mAllianceAuctions;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionHouseSearch.h"
+#include "AuctionHouseMgr.h"
+#include "DBCStores.h"
+#include "Item.h"
+#include "ObjectMgr.h"
+#include "World.h"
+
+AuctionSearchRecord::AuctionSearchRecord(AuctionEntry const* auction, Item* item)
+{
+    ItemTemplate const* proto = item->GetTemplate();
+
+    Id               = auction->Id;
+    ItemEntry        = proto->ItemId;
+    ItemClass        = proto->Class;
+    ItemSubClass     = proto->SubClass;
+    InventoryType    = proto->InventoryType;
+    Quality          = proto->Quality;
+    RequiredLevel    = proto->RequiredLevel;
+    RandomPropertyId = item->GetItemRandomPropertyId();
+    ExpireTime       = auction->expire_time;
+
+    auction->BuildAuctionInfo(Info, &TimeLeftPos);
+
+    for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+    {
+        LocaleConstant locale = LocaleConstant(i);
+        if (!IsThreadedSearchLocale(locale))
+            continue;
+
+        Names.push_back(std::make_pair(locale, std::wstring()));
+        BuildAuctionSearchName(proto, RandomPropertyId, locale, locale, Names.back().second);
+    }
+}
+
+std::wstring const* AuctionSearchRecord::GetName(LocaleConstant locale) const
+{
+    for (std::vector<std::pair<LocaleConstant, std::wstring> >::const_iterator itr = Names.begin(); itr != Names.end(); ++itr)
+        if (itr->first == locale)
+            return &itr->second;
+
+    return NULL;
+}
+
+bool IsThreadedSearchLocale(LocaleConstant locale)
+{
+    return sWorld->GetAvailableDbcLocale(locale) == locale;
+}
+
+void BuildAuctionSearchName(ItemTemplate const* proto, int32 randomPropertyId, int locIdx, int locDbcIdx, std::wstring& name)
+{
+    name.clear();
+
+    std::string itemName = proto->Name1;
+    if (itemName.empty())
+        return;
+
+    // local name
+    if (locIdx >= 0)
+        if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+            ObjectMgr::GetLocaleString(il->Name, locIdx, itemName);
+
+    if (randomPropertyId)
+    {
+        // Append the suffix to the name (ie: of the Monkey) if one exists
+        // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
+        //  even though the DBC names seem misleading
+        const ItemRandomPropertiesEntry* itemRandProp = sItemRandomPropertiesStore.LookupEntry(randomPropertyId);
+
+        if (itemRandProp)
+        {
+            char* temp = itemRandProp->nameSuffix;
+
+            // dbc local name
+            if (temp)
+            {
+                // Append the suffix (ie: of the Monkey) to the name using localization
+                // or default enUS if localization is invalid
+                itemName += ' ';
+                itemName += temp[locDbcIdx >= 0 ? locDbcIdx : LOCALE_enUS];
+            }
+        }
+    }
+
+    // names that are not valid utf8 never match, same as Utf8FitTo
+    if (Utf8toWStr(itemName, name))
+        wstrToLower(name);
+    else
+        name.clear();
+}
+
+int AuctionSearchRequest::call()
+{
+    AuctionSearchResult* result = new AuctionSearchResult(_query.AccountId);
+    WorldPacket& data = result->Packet;
+
+    uint32 count = 0;
+    uint32 totalcount = 0;
+    data << uint32(0);
+
+    time_t now = time(NULL);
+
+    for (AuctionSearchSnapshot::const_iterator itr = _snapshot->begin(); itr != _snapshot->end(); ++itr)
+    {
+        AuctionSearchRecord const& record = **itr;
+
+        if (_query.ItemClass != 0xffffffff && record.ItemClass != _query.ItemClass)
+            continue;
+
+        if (_query.ItemSubClass != 0xffffffff && record.ItemSubClass != _query.ItemSubClass)
+            continue;
+
+        if (_query.InventoryType != 0xffffffff && record.InventoryType != _query.InventoryType)
+            continue;
+
+        if (_query.Quality != 0xffffffff && record.Quality != _query.Quality)
+            continue;
+
+        if (_query.LevelMin != 0x00 && (record.RequiredLevel < _query.LevelMin || (_query.LevelMax != 0x00 && record.RequiredLevel > _query.LevelMax)))
+            continue;
+
+        if (!_query.SearchedName.empty())
+        {
+            std::wstring const* name = record.GetName(_query.Locale);
+            if (!name || name->find(_query.SearchedName) == std::wstring::npos)
+                continue;
+        }
+
+        if (count < 50 && totalcount >= _query.ListFrom)
+        {
+            ++count;
+            size_t pos = data.wpos();
+            data.append(record.Info);
+            data.put<uint32>(pos + record.TimeLeftPos, uint32((record.ExpireTime - now) * IN_MILLISECONDS));
+        }
+        ++totalcount;
+    }
+
+    data.put<uint32>(0, count);
+    data << uint32(totalcount);
+    data << uint32(300);                                  // 2.3.0 Max items searched display (number).
+
+    sAuctionMgr->AddSearchResult(result);
+    return 0;
+}
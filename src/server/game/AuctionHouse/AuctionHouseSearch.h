@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_HOUSE_SEARCH_H
+#define _AUCTION_HOUSE_SEARCH_H
+
+#include <ace/Method_Request.h>
+
+#include "Common.h"
+#include "WorldPacket.h"
+
+struct AuctionEntry;
+struct ItemTemplate;
+class Item;
+
+// Read only copy of what a browse search needs from one auction. A record is never
+// changed once built (a changed auction gets a new one), so search workers can use
+// it while the world thread keeps updating the auction house. Everything is built on
+// the world thread, workers do not touch item templates, locales or DBC stores.
+struct AuctionSearchRecord
+{
+    AuctionSearchRecord(AuctionEntry const* auction, Item* item);
+
+    // name searches are only threaded for locales with loaded DBCs, see IsThreadedSearchLocale
+    std::wstring const* GetName(LocaleConstant locale) const;
+
+    uint32 Id;
+    uint32 ItemEntry;
+    uint32 ItemClass;
+    uint32 ItemSubClass;
+    uint32 InventoryType;
+    uint32 Quality;
+    uint32 RequiredLevel;
+    int32 RandomPropertyId;
+    time_t ExpireTime;
+    ByteBuffer Info;                                        // AuctionEntry::BuildAuctionInfo output
+    size_t TimeLeftPos;                                     // time left in Info, written when the record is sent
+    std::vector<std::pair<LocaleConstant, std::wstring> > Names; // BuildAuctionSearchName output per threaded locale
+};
+
+typedef std::shared_ptr<AuctionSearchRecord const> AuctionSearchRecordPtr;
+typedef std::vector<AuctionSearchRecordPtr> AuctionSearchSnapshot; // ordered by auction id, like AuctionHouseObject::AuctionsMap
+typedef std::shared_ptr<AuctionSearchSnapshot const> AuctionSearchSnapshotPtr;
+
+struct AuctionSearchQuery
+{
+    uint32 AccountId;
+    std::wstring SearchedName;
+    uint32 ListFrom;
+    uint8 LevelMin;
+    uint8 LevelMax;
+    uint32 InventoryType;
+    uint32 ItemClass;
+    uint32 ItemSubClass;
+    uint32 Quality;
+    LocaleConstant Locale;                                  // session db locale, the dbc one follows from it
+};
+
+struct AuctionSearchResult
+{
+    explicit AuctionSearchResult(uint32 accountId) : AccountId(accountId), Packet(SMSG_AUCTION_LIST_RESULT, 4+4+4) {}
+
+    uint32 AccountId;
+    WorldPacket Packet;
+};
+
+// runs one browse query against a snapshot on a search worker thread, the result is
+// handed back through AuctionHouseMgr::AddSearchResult and sent from the world thread
+class AuctionSearchRequest : public ACE_Method_Request
+{
+    public:
+        AuctionSearchRequest(AuctionSearchQuery const& query, AuctionSearchSnapshotPtr const& snapshot)
+            : _query(query), _snapshot(snapshot) {}
+
+        virtual int call();
+
+    private:
+        AuctionSearchQuery _query;
+        AuctionSearchSnapshotPtr _snapshot;
+};
+
+// lower case item name with random suffix in the given locales, as matched by browse name searches
+void BuildAuctionSearchName(ItemTemplate const* proto, int32 randomPropertyId, int locIdx, int locDbcIdx, std::wstring& name);
+// records have search names for the locales that have their own DBCs loaded
+bool IsThreadedSearchLocale(LocaleConstant locale);
+
+#endif
@@ -53,6 +53,9 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  OpponentsTeamRating;                            // for rated arena matches
     uint32  OpponentsMatchmakerRating;                      // for rated arena matches
     Group* group;
+    BattlegroundBracketId BracketId;                        // bracket of the queue holding this group
+    uint8   QueueIndex;                                     // BattlegroundQueueGroupTypes list holding this group
+    std::list<GroupQueueInfo*>::iterator QueuePosition;     // position in that list, kept valid by moving groups with splice
 };
 
 enum BattlegroundQueueGroupTypes
@@ -123,6 +126,7 @@ class BattlegroundQueue
     private:
 
         bool InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, uint32 side);
+        void MoveGroupToQueueFront(GroupQueueInfo* ginfo, uint8 queueIndex);
         uint32 m_WaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
@@ -225,6 +225,7 @@ void Channel::Join(uint64 p, const char *pass)
 
     PlayerInfo pinfo;
     pinfo.player = p;
+    pinfo.plr = player;
     pinfo.flags = MEMBER_FLAG_NONE;
     players[p] = pinfo;
 
@@ -781,12 +782,14 @@ void Channel::SetOwner(uint64 guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, uint64 p)
 {
+    uint32 ignoredGuid = GUID_LOPART(p);
     for (PlayerList::const_iterator i = players.begin(); i != players.end(); ++i)
     {
-        Player* player = ObjectAccessor::FindPlayer(i->first);
+        Player* player = i->second.plr ? i->second.plr : ObjectAccessor::FindPlayer(i->first);
         if (player)
         {
-            if (!p || !player->GetSocial()->HasIgnore(GUID_LOPART(p)))
+            PlayerSocial* social = player->GetSocial();
+            if (!p || !social->HasIgnores() || !social->HasIgnore(ignoredGuid))
                 player->GetSession()->SendPacket(data);
         }
     }
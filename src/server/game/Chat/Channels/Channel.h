@@ -123,6 +123,7 @@ class Channel
     struct PlayerInfo
     {
         uint64 player;
+        Player* plr;                                        // set while online, members leave all channels on logout
         uint8 flags;
 
         bool HasFlag(uint8 flag) const { return flags & flag; }
@@ -259,6 +259,33 @@ void ThreatContainer::clearReferences()
         delete (*i);
     }
     iThreatList.clear();
+    iThreatIndex.clear();
+    iChangedRefs.clear();
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    iThreatList.push_back(hostileRef);
+    iThreatIndex[hostileRef->getUnitGuid()] = --iThreatList.end();
+
+    // appended at the end, let the next update() move it to its place
+    markReferenceChanged(hostileRef);
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    ThreatIndex::iterator itr = iThreatIndex.find(hostileRef->getUnitGuid());
+    if (itr != iThreatIndex.end() && *itr->second == hostileRef)
+    {
+        iThreatList.erase(itr->second);
+        iThreatIndex.erase(itr);
+    }
+    else
+        iThreatList.remove(hostileRef);
 }
 
 //============================================================
@@ -268,10 +295,9 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim)
     if (!victim)
         return NULL;
 
-    uint64 guid = victim->GetGUID();
-    for (std::list<HostileReference*>::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-        if ((*i) && (*i)->getUnitGuid() == guid)
-            return (*i);
+    ThreatIndex::const_iterator itr = iThreatIndex.find(victim->GetGUID());
+    if (itr != iThreatIndex.end())
+        return *itr->second;
 
     return NULL;
 }
@@ -300,12 +326,73 @@ void ThreatContainer::modifyThreatPercent(Unit* victim, int32 percent)
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(SkyMistCore::ThreatOrderPred());
+    if (iThreatList.size() > 1)
+    {
+        // list::sort relinks the nodes, so the iterators of the index stay valid
+        if (iDirty)
+            iThreatList.sort(SkyMistCore::ThreatOrderPred());
+        else
+        {
+            // take all changed refs out first, so they are only compared against the still sorted rest
+            std::sort(iChangedRefs.begin(), iChangedRefs.end());
+            iChangedRefs.erase(std::unique(iChangedRefs.begin(), iChangedRefs.end()), iChangedRefs.end());
+
+            ThreatList changed;
+            for (std::vector<uint64>::const_iterator i = iChangedRefs.begin(); i != iChangedRefs.end(); ++i)
+            {
+                ThreatIndex::const_iterator itr = iThreatIndex.find(*i);
+                if (itr != iThreatIndex.end())
+                    changed.splice(changed.end(), iThreatList, itr->second);
+            }
+
+            while (!changed.empty())
+                reinsert(changed, changed.begin());
+        }
+    }
 
+    iChangedRefs.clear();
     iDirty = false;
 }
 
+//============================================================
+// Only the changed references are moved, the rest of the list is still sorted.
+// Each move walks the list, so past log2(n) changed refs a full sort is cheaper
+
+void ThreatContainer::markReferenceChanged(HostileReference* hostileRef)
+{
+    if (iDirty)
+        return;
+
+    uint32 maxChanged = 1;
+    for (size_t size = iThreatList.size(); size > 1; size >>= 1)
+        ++maxChanged;
+
+    if (iChangedRefs.size() >= maxChanged)
+    {
+        iChangedRefs.clear();
+        iDirty = true;
+        return;
+    }
+
+    iChangedRefs.push_back(hostileRef->getUnitGuid());
+}
+
+//============================================================
+// Linear in the list size, markReferenceChanged keeps the number of
+// calls per update low enough to stay below the cost of a full sort
+
+void ThreatContainer::reinsert(ThreatList& from, ThreatList::iterator itr)
+{
+    float threat = (*itr)->getThreat();
+
+    ThreatList::iterator pos = iThreatList.begin();
+    while (pos != iThreatList.end() && (*pos)->getThreat() >= threat)
+        ++pos;
+
+    // splice keeps itr valid, no need to touch the index
+    iThreatList.splice(pos, from, itr);
+}
+
 //============================================================
 // return the next best victim
 // could be the current victim
@@ -528,36 +615,28 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
     switch (threatRefStatusChangeEvent->getType())
     {
         case UEV_THREAT_REF_THREAT_CHANGE:
-            if ((getCurrentVictim() == hostilRef && threatRefStatusChangeEvent->getFValue()<0.0f) ||
-                (getCurrentVictim() != hostilRef && threatRefStatusChangeEvent->getFValue()>0.0f))
-                setDirty(true);                             // the order in the threat list might have changed
+            if (hostilRef->isOnline())
+                iThreatContainer.markReferenceChanged(hostilRef); // the order in the threat list might have changed
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
+            // removing a reference keeps the list sorted, a re-added one is queued by addReference
             if (!hostilRef->isOnline())
             {
                 if (hostilRef == getCurrentVictim())
-                {
                     setCurrentVictim(NULL);
-                    setDirty(true);
-                }
                 iOwner->SendRemoveFromThreatListOpcode(hostilRef);
                 iThreatContainer.remove(hostilRef);
                 iThreatOfflineContainer.addReference(hostilRef);
             }
             else
             {
-                if (getCurrentVictim() && hostilRef->getThreat() > (1.1f * getCurrentVictim()->getThreat()))
-                    setDirty(true);
                 iThreatContainer.addReference(hostilRef);
                 iThreatOfflineContainer.remove(hostilRef);
             }
             break;
         case UEV_THREAT_REF_REMOVE_FROM_LIST:
             if (hostilRef == getCurrentVictim())
-            {
                 setCurrentVictim(NULL);
-                setDirty(true);
-            }
             iOwner->SendRemoveFromThreatListOpcode(hostilRef);
             if (hostilRef->isOnline())
                 iThreatContainer.remove(hostilRef);
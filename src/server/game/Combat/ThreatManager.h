@@ -25,6 +25,7 @@
 #include "UnitEvents.h"
 
 #include <list>
+#include <vector>
 
 //==============================================================
 
@@ -143,15 +144,23 @@ class ThreatManager;
 class ThreatContainer
 {
     private:
-        std::list<HostileReference*> iThreatList;
+        typedef std::list<HostileReference*> ThreatList;
+        typedef UNORDERED_MAP<uint64, ThreatList::iterator> ThreatIndex;
+
+        ThreatList iThreatList;
+        ThreatIndex iThreatIndex;                           // guid -> position in iThreatList
+        std::vector<uint64> iChangedRefs;                   // refs whose threat changed since the last update()
         bool iDirty;
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* hostileRef) { iThreatList.remove(hostileRef); }
-        void addReference(HostileReference* hostileRef) { iThreatList.push_back(hostileRef); }
+        void remove(HostileReference* hostileRef);
+        void addReference(HostileReference* hostileRef);
         void clearReferences();
 
+        // Remember that the threat of this reference changed, only it will be moved on next update()
+        void markReferenceChanged(HostileReference* hostileRef);
+
         // Sort the list if necessary
         void update();
     public:
@@ -164,9 +173,10 @@ class ThreatContainer
 
         HostileReference* selectNextVictim(Creature* attacker, HostileReference* currentVictim);
 
+        // full resort of the list on next update()
         void setDirty(bool isDirty) { iDirty = isDirty; }
 
-        bool isDirty() const { return iDirty; }
+        bool isDirty() const { return iDirty || !iChangedRefs.empty(); }
 
         bool empty() const { return iThreatList.empty(); }
 
@@ -175,6 +185,9 @@ class ThreatContainer
         HostileReference* getReferenceByTarget(Unit* victim);
 
         std::list<HostileReference*>& getThreatList() { return iThreatList; }
+    private:
+        // Move a reference taken out of the list back to its sorted place
+        void reinsert(ThreatList& from, ThreatList::iterator itr);
 };
 
 //=================================================
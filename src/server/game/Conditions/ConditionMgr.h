@@ -90,12 +90,13 @@ enum ConditionTypes
 
     Step 6: Determine how you are going to store your conditions. You need to add a new storage container
             for it in ConditionMgr class, along with a function like:
-            ConditionList GetConditionsForXXXYourNewSourceTypeXXX(parameters...)
+            ConditionList const& GetConditionsForXXXYourNewSourceTypeXXX(parameters...)
 
             The above function should be placed in upper level (practical) code that actually
             checks the conditions.
 
-    Step 7: Implement loading for your source type in ConditionMgr::LoadConditions.
+    Step 7: Implement loading for your source type in ConditionMgr::LoadConditions,
+            adding to the lists through ConditionMgr::AddToConditionList.
 
     Step 8: Implement memory cleaning for your source type in ConditionMgr::Clean.
 */
@@ -156,6 +157,14 @@ enum MaxConditionTargets
     MAX_CONDITION_TARGETS = 3
 };
 
+// rough cost of Condition::Meets, cheaper conditions of an ElseGroup are checked first
+enum ConditionEvaluationCost
+{
+    CONDITION_COST_LOW              = 0,                    // plain field checks on the target
+    CONDITION_COST_MEDIUM           = 1,                    // container lookups (auras, quests, skills, references...)
+    CONDITION_COST_HIGH             = 2                     // inventory scans, grid searches and instance scripts
+};
+
 struct ConditionSourceInfo
 {
     WorldObject* mConditionTargets[MAX_CONDITION_TARGETS]; // an array of targets available for conditions
@@ -204,20 +213,21 @@ struct Condition
     }
 
     bool Meets(ConditionSourceInfo& sourceInfo);
+    ConditionEvaluationCost GetEvaluationCost() const;
     uint32 GetSearcherTypeMaskForCondition();
     bool isLoaded() const { return ConditionType > CONDITION_NONE || ReferenceId; }
     uint32 GetMaxAvailableConditionTargets();
 };
 
+// kept ordered by ElseGroup and then by evaluation cost, see ConditionMgr::AddToConditionList
 typedef std::list<Condition*> ConditionList;
-typedef std::map<uint32, ConditionList> ConditionTypeContainer;
-typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
-typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
-typedef std::map<int32 /*zoneId*/, ConditionTypeContainer> PhaseDefinitionConditionContainer;
+typedef UNORDERED_MAP<uint32, ConditionList> ConditionTypeContainer;
+typedef UNORDERED_MAP<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
+typedef UNORDERED_MAP<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
+typedef UNORDERED_MAP<uint64 /*entryOrGuid, SAI source_type*/, ConditionTypeContainer> SmartEventConditionContainer;
+typedef UNORDERED_MAP<int32 /*zoneId*/, ConditionTypeContainer> PhaseDefinitionConditionContainer;
 
-typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
+typedef UNORDERED_MAP<uint32, ConditionList> ConditionReferenceContainer;//only used for references
 
 class ConditionMgr
 {
@@ -238,12 +248,14 @@ class ConditionMgr
         bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
         bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
         bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-        ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
-        ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
-        ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
-        ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
-        ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
-        ConditionList GetConditionsForPhaseDefinition(uint32 zone, uint32 entry);
+        ConditionList const& GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
+        ConditionList const& GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
+        ConditionList const& GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
+        ConditionList const& GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
+        ConditionList const& GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
+        ConditionList const& GetConditionsForPhaseDefinition(uint32 zone, uint32 entry);
+
+        static void AddToConditionList(ConditionList& conditions, Condition* cond);
 
     private:
         bool isSourceTypeValid(Condition* cond);
@@ -256,7 +268,8 @@ class ConditionMgr
         void Clean(); // free up resources
         std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
 
-        ConditionContainer                ConditionStore;
+        ConditionList                     EmptyConditionList;  // returned by the getters when nothing is stored
+        ConditionTypeContainer            ConditionStore[CONDITION_SOURCE_TYPE_MAX];
         ConditionReferenceContainer       ConditionReferenceStore;
         CreatureSpellConditionContainer   VehicleSpellConditionStore;
         CreatureSpellConditionContainer   SpellClickEventConditionStore;
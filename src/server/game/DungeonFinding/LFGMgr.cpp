@@ -290,7 +290,8 @@ void LFGMgr::Update(uint32 diff)
             firstNew.push_back(frontguid);
             newToQueue.pop_front();
             uint8 alreadyInQueue = 0;
-            LfgGuidList temporalList = currentQueue;
+            LfgGuidList temporalList;
+            GetQueueCandidates(frontguid, currentQueue, temporalList);
             if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, TYPEID_DUNGEON)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
@@ -328,7 +329,7 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
+                GetQueueCandidates(frontguid, currentQueue, temporalList);
                 m_CompatibleMap.clear();
             }
 
@@ -369,7 +370,7 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
+                GetQueueCandidates(frontguid, currentQueue, temporalList);
                 m_CompatibleMap.clear();
             }
 
@@ -410,7 +411,7 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
+                GetQueueCandidates(frontguid, currentQueue, temporalList);
             }
 
             if (alreadyInQueue == 3 && std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end())
@@ -974,6 +975,55 @@ void LFGMgr::OfferContinue(Group* grp)
     }
 }
 
+/**
+   Builds the list of queued guids a new entry could be matched with. Entries
+   that do not share a single dungeon with the new one can never end in a
+   compatible group, so they are dropped here instead of being tried by
+   FindNewGroups one by one. Queue order is kept, so older entries are still
+   matched first.
+
+   @param[in]     guid Guid of the entry joining the queue
+   @param[in]     queue Current queue
+   @param[out]    candidates Queued guids worth checking against guid
+*/
+void LFGMgr::GetQueueCandidates(uint64 guid, LfgGuidList const& queue, LfgGuidList& candidates)
+{
+    candidates.clear();
+
+    LfgQueueInfoMap::const_iterator itNew = m_QueueInfoMap.find(guid);
+    if (itNew == m_QueueInfoMap.end() || itNew->second->dungeons.empty())
+    {
+        candidates = queue;
+        return;
+    }
+
+    LfgDungeonSet const& dungeons = itNew->second->dungeons;
+    for (LfgGuidList::const_iterator it = queue.begin(); it != queue.end(); ++it)
+    {
+        LfgQueueInfoMap::const_iterator itQueue = m_QueueInfoMap.find(*it);
+        // Keep stale entries, CheckCompatibility takes care of removing them
+        if (itQueue == m_QueueInfoMap.end() || GetState(*it) != LFG_STATE_QUEUED)
+        {
+            candidates.push_back(*it);
+            continue;
+        }
+
+        LfgDungeonSet const& other = itQueue->second->dungeons;
+        LfgDungeonSet const& small = other.size() < dungeons.size() ? other : dungeons;
+        LfgDungeonSet const& large = other.size() < dungeons.size() ? dungeons : other;
+        for (LfgDungeonSet::const_iterator itDungeon = small.begin(); itDungeon != small.end(); ++itDungeon)
+        {
+            if (large.find(*itDungeon) != large.end())
+            {
+                candidates.push_back(*it);
+                break;
+            }
+        }
+    }
+
+    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetQueueCandidates: [" UI64FMTD "] %u of %u queued entries share a dungeon", guid, uint32(candidates.size()), uint32(queue.size()));
+}
+
 /**
    Checks que main queue to try to form a Lfg group. Returns first match found (if any)
 
@@ -983,7 +1033,9 @@ void LFGMgr::OfferContinue(Group* grp)
 */
 LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType type)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
+    // Building the guid strings is linear in the queue size, skip it unless it will be logged
+    if (sLog->ShouldLog(LOG_FILTER_LFG, LOG_LEVEL_DEBUG))
+        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
 
     uint8 maxGroupSize = 5;
     if (type == LFG_SUBTYPEID_RAID)
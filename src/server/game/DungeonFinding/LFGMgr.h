@@ -356,6 +356,7 @@ class LFGMgr
         void RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType type);
 
         // Group Matching
+        void GetQueueCandidates(uint64 guid, LfgGuidList const& queue, LfgGuidList& candidates);
         LfgProposal* FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType type);
         bool CheckGroupRoles(LfgRolesMap &groles, LfgType type, bool removeLeaderFlag = true);
         bool CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgType type);
@@ -144,7 +144,7 @@ lootForPickPocketed(false), lootForBody(false), m_groupLootTimer(0), lootingGrou
 m_PlayerDamageReq(0), m_lootRecipient(0), m_lootRecipientGroup(0), m_corpseRemoveTime(0), m_respawnTime(0),
 m_respawnDelay(300), m_corpseDelay(60), m_respawnradius(0.0f), m_reactState(REACT_AGGRESSIVE),
 m_defaultMovementType(IDLE_MOTION_TYPE), m_DBTableGuid(0), m_equipmentId(0), m_AlreadyCallAssistance(false),
-m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL),
+m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_dormant(false), m_dormantDiff(0), m_dormantCheckTimer(0), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL),
 m_creatureInfo(NULL), m_creatureData(NULL), m_path_id(0), m_formation(NULL), m_battleground(NULL)
 {
     m_regenTimer = CREATURE_REGEN_INTERVAL;
@@ -495,6 +495,29 @@ void Creature::Update(uint32 diff)
     else
         m_LOSCheckTimer -= diff;
 
+    if (m_dormant)
+    {
+        m_dormantDiff += diff;
+
+        // anything that needs the creature to be updated now wakes it up
+        if (m_dormantDiff < sWorld->getIntConfig(CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL) && isAlive() && !isInCombat() &&
+            m_Events.Empty() && movespline->Finalized() && !HasUnitState(UNIT_STATE_CASTING) && !NeedChangeAI && !TriggerJustRespawned)
+        {
+            GetMap()->CountCreatureUpdate(true);
+            return;
+        }
+
+        m_dormant = false;
+    }
+
+    GetMap()->CountCreatureUpdate(false);
+
+    if (m_dormantDiff)
+    {
+        diff += m_dormantDiff;
+        m_dormantDiff = 0;
+    }
+
     // Zone Skip Update
     if ((sObjectMgr->IsSkipZone(GetZoneId()) && (!isInCombat() && !GetMap()->Instanceable())) && (!isTotem() || GetOwner()))
     {
@@ -679,6 +702,55 @@ void Creature::Update(uint32 diff)
     }
 
     sScriptMgr->OnCreatureUpdate(this, diff);
+
+    // the player search is too costly for every tick, check once per dormant update interval
+    if (m_dormantCheckTimer <= diff)
+    {
+        m_dormantCheckTimer = sWorld->getIntConfig(CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL);
+        m_dormant = CanBeDormant();
+    }
+    else
+        m_dormantCheckTimer -= diff;
+}
+
+bool Creature::CanBeDormant()
+{
+    if (!sWorld->getIntConfig(CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL))
+        return false;
+
+    if (!IsInWorld() || !isAlive() || isInCombat() || IsInEvadeMode() || !getThreatManager().isThreatListEmpty())
+        return false;
+
+    // scripted, controlled and player related creatures keep their own timing,
+    // SmartAI/EventAI set by AIName may have out of combat timed events too
+    if (GetScriptId() || (IsAIEnabled && !GetAIName().empty()) || isActiveObject() || isSummon() || IsVehicle() || GetVehicle() || GetCharmerOrOwnerGUID() || GetMap()->Instanceable())
+        return false;
+
+    if (!m_Events.Empty() || !movespline->Finalized() || HasUnitState(UNIT_STATE_CASTING) ||
+        GetMotionMaster()->GetCurrentMovementGeneratorType() != IDLE_MOTION_TYPE)
+        return false;
+
+    if (GetHealth() < GetMaxHealth() || GetPower(getPowerType()) < GetMaxPower(getPowerType()))
+        return false;
+
+    // expiring auras are handled on time
+    for (AuraMap::const_iterator itr = GetOwnedAuras().begin(); itr != GetOwnedAuras().end(); ++itr)
+        if (!itr->second->IsPermanent())
+            return false;
+
+    // players see further than creatures do, use the same range as visibility
+    float range = GetMap()->GetVisibilityRange();
+    Player* player = NULL;
+    SkyMistCore::AnyPlayerInObjectRangeCheck check(this, range, false);
+    SkyMistCore::PlayerSearcher<SkyMistCore::AnyPlayerInObjectRangeCheck> searcher(this, player, check);
+    VisitNearbyWorldObject(range, searcher);
+    return !player;
+}
+
+void Creature::WakeUpFor(Unit const* who)
+{
+    if (m_dormant && who->IsControlledByPlayer() && IsWithinDistInMap(who, GetMap()->GetVisibilityRange()))
+        m_dormant = false;
 }
 
 void Creature::RegenerateMana()
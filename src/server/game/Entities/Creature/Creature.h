@@ -838,6 +838,11 @@ class Creature : public Unit, public GridObject<Creature>, public MapCreature
         bool m_LOSCheck_creature;
         bool m_LOSCheck_player;
 
+        // idle creatures out of sight range of all players only get a full update every CreatureDormantUpdateInterval
+        bool IsDormant() const { return m_dormant; }
+        void WakeUp() { m_dormant = false; }
+        void WakeUpFor(Unit const* who);
+
         Battleground* GetBattleground() const { return m_battleground; }
         void SetBattleground(Battleground* bg) { m_battleground = bg; }
 
@@ -875,6 +880,11 @@ class Creature : public Unit, public GridObject<Creature>, public MapCreature
         bool m_regenHealth;
         bool m_AI_locked;
 
+        bool CanBeDormant();
+        bool m_dormant;
+        uint32 m_dormantDiff;                               // update time skipped while dormant, given to the next full update
+        uint32 m_dormantCheckTimer;                         // time left until CanBeDormant is checked again
+
         SpellSchoolMask m_meleeDamageSchoolMask;
         uint32 m_originalEntry;
 
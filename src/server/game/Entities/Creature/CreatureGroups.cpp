@@ -19,6 +19,7 @@
 #include "Creature.h"
 #include "CreatureGroups.h"
 #include "ObjectMgr.h"
+#include "WaypointManager.h"
 
 #include "CreatureAI.h"
 
@@ -162,6 +163,7 @@ void CreatureGroup::RemoveMember(Creature* member)
 
     m_members.erase(member);
     member->SetFormation(NULL);
+    m_memberPoints.clear();
 }
 
 void CreatureGroup::MemberAttackStart(Creature* member, Unit* target)
@@ -209,7 +211,7 @@ void CreatureGroup::FormationReset(bool dismiss)
     m_Formed = !dismiss;
 }
 
-void CreatureGroup::LeaderMoveTo(float x, float y, float z)
+void CreatureGroup::LeaderMoveTo(float x, float y, float z, WaypointData const* node)
 {
     // @TODO : This should probably get its own movement generator or use WaypointMovementGenerator.
     // If the leader's path is known, member's path can be plotted as well using formation offsets.
@@ -241,7 +243,23 @@ void CreatureGroup::LeaderMoveTo(float x, float y, float z)
         SkyMistCore::NormalizeMapCoord(dx);
         SkyMistCore::NormalizeMapCoord(dy);
 
-        member->UpdateGroundPositionZ(dx, dy, dz);
+        // a patrol reaches its waypoints from the same place every round, reuse the member's ground height then
+        if (node)
+        {
+            FormationMemberPoint& point = m_memberPoints[MAKE_PAIR64(node->id, member->GetDBTableGUIDLow())];
+            if (point.phaseMask == member->GetPhaseMask() && fabs(point.x - dx) < 0.1f && fabs(point.y - dy) < 0.1f)
+                dz = point.z;
+            else
+            {
+                member->UpdateGroundPositionZ(dx, dy, dz);
+                point.x = dx;
+                point.y = dy;
+                point.z = dz;
+                point.phaseMask = member->GetPhaseMask();
+            }
+        }
+        else
+            member->UpdateGroundPositionZ(dx, dy, dz);
 
         if (member->IsWithinDist(m_leader, dist + MAX_DESYNC))
             member->SetUnitMovementFlags(m_leader->GetUnitMovementFlags());
@@ -25,6 +25,7 @@
 
 class Creature;
 class CreatureGroup;
+struct WaypointData;
 
 struct FormationInfo
 {
@@ -38,6 +39,15 @@ struct FormationInfo
 
 typedef UNORDERED_MAP<uint32/*memberDBGUID*/, FormationInfo*>   CreatureGroupInfoType;
 
+// member destination for one waypoint of the leader, kept so ground height is only looked up once per patrol point
+struct FormationMemberPoint
+{
+    float x, y, z;
+    uint32 phaseMask;
+};
+
+typedef UNORDERED_MAP<uint64/*MAKE_PAIR64(waypoint, memberDBGUID)*/, FormationMemberPoint> FormationMemberPointCache;
+
 class FormationMgr
 {
     friend class ACE_Singleton<FormationMgr, ACE_Null_Mutex>;
@@ -56,6 +66,7 @@ class CreatureGroup
         Creature* m_leader;                             // Important do not forget sometimes to work with pointers instead synonims
         typedef std::map<Creature*, FormationInfo*>  CreatureGroupMemberType;
         CreatureGroupMemberType m_members;
+        FormationMemberPointCache m_memberPoints;
 
         uint32 m_groupID;
         bool m_Formed;
@@ -74,7 +85,7 @@ class CreatureGroup
         void RemoveMember(Creature* member);
         void FormationReset(bool dismiss);
 
-        void LeaderMoveTo(float x, float y, float z);
+        void LeaderMoveTo(float x, float y, float z, WaypointData const* node = NULL);
         void MemberAttackStart(Creature* member, Unit* target);
 };
 
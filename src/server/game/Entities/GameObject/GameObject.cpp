@@ -2205,7 +2205,15 @@ void GameObject::EnableCollision(bool enable)
     /*if (enable && !GetMap()->ContainsGameObjectModel(*m_model))
         GetMap()->InsertGameObjectModel(*m_model);*/
 
-    m_model->enable(enable ? GetPhaseMask() : 0);
+    // door and chest state updates call this without changing anything, don't scan the LoS cache for them
+    uint32 phaseMask = enable ? GetPhaseMask() : 0;
+    if (m_model->getPhaseMask() == phaseMask)
+        return;
+
+    m_model->enable(phaseMask);
+
+    if (IsInWorld())
+        GetMap()->InvalidateLOSCache(m_model->getBounds());
 }
 
 void GameObject::UpdateModel()
@@ -3144,7 +3144,8 @@ class Player : public Unit, public GridObject<Player>
         void _LoadVoidStorage(PreparedQueryResult result);
         void _LoadMailInit(PreparedQueryResult resultUnread, PreparedQueryResult resultDelivery);
         void _LoadMail();
-        void _LoadMailedItems(Mail* mail);
+        typedef UNORDERED_MAP<uint32 /*messageId*/, Mail*> MailItemsLoadMap;
+        void _LoadMailedItems(MailItemsLoadMap const& mails);
         void _LoadQuestStatus(PreparedQueryResult result);
         void _LoadQuestStatusRewarded(PreparedQueryResult result);
         void _LoadDailyQuestStatus(PreparedQueryResult result);
@@ -30,6 +30,7 @@
 PlayerSocial::PlayerSocial()
 {
     m_playerGUID = 0;
+    m_ignoreCount = 0;
 }
 
 PlayerSocial::~PlayerSocial()
@@ -76,6 +77,9 @@ bool PlayerSocial::AddToSocialList(uint32 friendGuid, bool ignore)
 
         CharacterDatabase.Execute(stmt);
 
+        if (ignore && !(itr->second.Flags & SOCIAL_FLAG_IGNORED))
+            ++m_ignoreCount;
+
         m_playerSocialMap[friendGuid].Flags |= flag;
     }
     else
@@ -91,6 +95,9 @@ bool PlayerSocial::AddToSocialList(uint32 friendGuid, bool ignore)
         FriendInfo fi;
         fi.Flags |= flag;
         m_playerSocialMap[friendGuid] = fi;
+
+        if (ignore)
+            ++m_ignoreCount;
     }
 
     return true;
@@ -106,6 +113,9 @@ void PlayerSocial::RemoveFromSocialList(uint32 friendGuid, bool ignore)
     if (ignore)
         flag = SOCIAL_FLAG_IGNORED;
 
+    if (ignore && (itr->second.Flags & SOCIAL_FLAG_IGNORED))
+        --m_ignoreCount;
+
     itr->second.Flags &= ~flag;
     if (itr->second.Flags == 0)
     {
@@ -380,6 +390,8 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, uint32 guid)
     }
     while (result->NextRow());
 
+    social->m_ignoreCount = social->GetNumberOfSocialsWithFlag(SOCIAL_FLAG_IGNORED);
+
     return social;
 }
 
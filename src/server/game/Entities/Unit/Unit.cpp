@@ -215,6 +215,7 @@ Unit::Unit(bool isWorldObject): WorldObject(isWorldObject)
         m_ObjectSlot[i] = 0;
 
     m_auraUpdateIterator = m_ownedAuras.end();
+    m_procTriggerAurasGeneration = sSpellMgr->GetProcDataGeneration();
 
     m_interruptMask = 0;
     m_transform = 0;
@@ -3755,6 +3756,9 @@ AuraApplication * Unit::_CreateAuraApplication(AuraPtr aura, uint32 effMask)
     if (AuraStateType aState = aura->GetSpellInfo()->GetAuraState())
         m_auraStateAuras.insert(AuraStateAurasMap::value_type(aState, aurApp));
 
+    if (uint32 procFlags = GetProcTriggerFlags(aurSpellInfo))
+        m_procTriggerAuras.insert(ProcTriggerAurasMap::value_type(aurId, std::make_pair(aurApp, procFlags)));
+
     aura->_ApplyForTarget(this, caster, aurApp);
     return aurApp;
 }
@@ -3843,6 +3847,15 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator &i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    for (ProcTriggerAurasMap::iterator itr = m_procTriggerAuras.lower_bound(aura->GetId()); itr != m_procTriggerAuras.upper_bound(aura->GetId()); ++itr)
+    {
+        if (itr->second.first == aurApp)
+        {
+            m_procTriggerAuras.erase(itr);
+            break;
+        }
+    }
+
     if (aura->GetSpellInfo()->AuraInterruptFlags)
     {
         m_interruptableAuras.remove(aurApp);
@@ -17699,24 +17712,37 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
     HealInfo healInfo = HealInfo(actor, actionTarget, damage, procSpell, procSpell ? SpellSchoolMask(procSpell->SchoolMask) : SPELL_SCHOOL_MASK_NORMAL);
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, 0, procExtra, NULL, &damageInfo, &healInfo);
 
+    // proc_event tables were reloaded, flags stored for the applied auras may be outdated
+    if (m_procTriggerAurasGeneration != sSpellMgr->GetProcDataGeneration())
+        RebuildProcTriggerAuras();
+
+    if (isVictim)
+        procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
+
+    bool procStats = sSpellMgr->IsProcStatsEnabled();
+
     ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr!= GetAppliedAuras().end(); ++itr)
+    // Fill procTriggered list, only auras reacting to one of the event flags can pass IsTriggeredAtSpellProcEvent
+    for (ProcTriggerAurasMap::const_iterator itr = m_procTriggerAuras.begin(); itr != m_procTriggerAuras.end(); ++itr)
     {
+        if (!(itr->second.second & procFlag))
+            continue;
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
-        ProcTriggeredData triggerData(itr->second->GetBase());
+        AuraApplication* aurApp = itr->second.first;
+        ProcTriggeredData triggerData(aurApp->GetBase());
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = damage || (procExtra & PROC_EX_BLOCK && isVictim);
-        if (isVictim)
-            procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
         // only auras that has triggered spell should proc from fully absorbed damage
-        SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
+        SpellInfo const* spellProto = aurApp->GetBase()->GetSpellInfo();
         if (!spellProto)
             continue;
 
+        if (procStats)
+            sSpellMgr->AddProcStat(spellProto->Id, false);
+
         if ((procExtra & PROC_EX_ABSORB && isVictim) || ((procFlag & PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG) && spellProto->DmgClass == SPELL_DAMAGE_CLASS_MAGIC))
         {
             bool triggerSpell = false;
@@ -17760,13 +17786,13 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             continue;
 
         // do checks using conditions table
-        ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
         ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
         if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
             continue;
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second, eventInfo))
+        if (!triggerData.aura->CallScriptCheckProcHandlers(aurApp, eventInfo))
             continue;
 
         // Triggered spells not triggering additional spells
@@ -17775,9 +17801,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
-            if (itr->second->HasEffect(i))
+            if (aurApp->HasEffect(i))
             {
-                AuraEffectPtr aurEff = itr->second->GetBase()->GetEffect(i);
+                AuraEffectPtr aurEff = aurApp->GetBase()->GetEffect(i);
                 // Skip this auras
                 if (isNonTriggerAura[aurEff->GetAuraType()])
                     continue;
@@ -17790,7 +17816,11 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             }
         }
         if (triggerData.effMask)
+        {
             procTriggered.push_front(triggerData);
+            if (procStats)
+                sSpellMgr->AddProcStat(spellProto->Id, true);
+        }
     }
 
     // Glyph of grounding totem
@@ -18835,6 +18865,45 @@ bool Unit::InitTamedPet(Pet* pet, uint8 level, uint32 spell_id)
     return true;
 }
 
+// Returns proc flags which can make IsTriggeredAtSpellProcEvent accept the aura, 0 if it never can
+uint32 Unit::GetProcTriggerFlags(SpellInfo const* spellProto)
+{
+    // handled by new proc system
+    if (sSpellMgr->GetSpellProcEntry(spellProto->Id))
+        return 0;
+
+    uint32 EventProcFlag = spellProto->ProcFlags;
+    if (SpellProcEventEntry const* spellProcEvent = sSpellMgr->GetSpellProcEvent(spellProto->Id))
+        if (spellProcEvent->procFlags)
+            EventProcFlag = spellProcEvent->procFlags;
+
+    if (!EventProcFlag)
+        return 0;
+
+    // hack fixed auras in IsTriggeredAtSpellProcEvent ignore procFlags check
+    switch (spellProto->Id)
+    {
+        case 44448:
+        case 117896:
+        case 121152:
+            return 0xFFFFFFFF;
+        default:
+            break;
+    }
+
+    return EventProcFlag;
+}
+
+void Unit::RebuildProcTriggerAuras()
+{
+    m_procTriggerAuras.clear();
+    for (AuraApplicationMap::const_iterator itr = m_appliedAuras.begin(); itr != m_appliedAuras.end(); ++itr)
+        if (uint32 procFlags = GetProcTriggerFlags(itr->second->GetBase()->GetSpellInfo()))
+            m_procTriggerAuras.insert(ProcTriggerAurasMap::value_type(itr->first, std::make_pair(itr->second, procFlags)));
+
+    m_procTriggerAurasGeneration = sSpellMgr->GetProcDataGeneration();
+}
+
 bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, AuraPtr aura, SpellInfo const* procSpell, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const* & spellProcEvent)
 {
     SpellInfo const* spellProto = aura->GetSpellInfo();
@@ -21194,7 +21263,7 @@ bool Unit::HandleSpellClick(Unit* clicker, int8 seatId)
             return false;
 
         //! Check database conditions
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
+        ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(clicker, this);
         if (!sConditionMgr->IsObjectMeetToConditions(info, conds))
             return false;
@@ -1216,6 +1216,7 @@ class Unit : public WorldObject
         typedef std::multimap<uint32,  AuraPtr> AuraMap;
         typedef std::multimap<uint32,  AuraApplication*> AuraApplicationMap;
         typedef std::multimap<AuraStateType,  AuraApplication*> AuraStateAurasMap;
+        typedef std::multimap<uint32,  std::pair<AuraApplication*, uint32 /*procFlags*/> > ProcTriggerAurasMap;
         typedef std::list<AuraEffectPtr> AuraEffectList;
         typedef std::list<AuraPtr> AuraList;
         typedef std::list<AuraApplication *> AuraApplicationList;
@@ -2379,6 +2380,8 @@ class Unit : public WorldObject
         AuraList m_scAuras;                        // casted singlecast auras
         AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
+        ProcTriggerAurasMap m_procTriggerAuras;    // applied auras which can be triggered by ProcDamageAndSpellFor, keyed like m_appliedAuras
+        uint32 m_procTriggerAurasGeneration;       // SpellMgr proc data generation m_procTriggerAuras was built with
         uint32 m_interruptMask;
         AuraList _SoulSwapDOTList;
 
@@ -2428,6 +2431,8 @@ class Unit : public WorldObject
         uint32 m_oldEmoteState; // Used to store and restore old emote states for creatures.
 
     private:
+        static uint32 GetProcTriggerFlags(SpellInfo const* spellProto);
+        void RebuildProcTriggerAuras();
         bool IsTriggeredAtSpellProcEvent(Unit* victim, AuraPtr aura, SpellInfo const* procSpell, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const* & spellProcEvent);
         bool HandleAuraProcOnPowerAmount(Unit* victim, uint32 damage, AuraEffectPtr triggeredByAura, SpellInfo const *procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown);
         bool HandleDummyAuraProc(Unit* victim, uint32 damage, AuraEffectPtr triggeredByAura, SpellInfo const* procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown);
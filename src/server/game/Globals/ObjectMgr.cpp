@@ -252,7 +252,7 @@ bool SpellClickInfo::IsFitToRequirements(Unit const* clicker, Unit const* clicke
 ObjectMgr::ObjectMgr(): _auctionId(1), _equipmentSetGuid(1),
     _itemTextId(1), _mailId(1), _hiPetNumber(1), _voidItemId(1), _hiCharGuid(1),
     _hiCreatureGuid(1), _hiPetGuid(1), _hiVehicleGuid(1), _hiItemGuid(1),
-    _hiGoGuid(1), _hiDoGuid(1), _hiCorpseGuid(1), _hiMoTransGuid(1), _hiAreaTriggerGuid(1), _skipUpdateCount(1)
+    _hiGoGuid(1), _hiDoGuid(1), _hiCorpseGuid(1), _hiMoTransGuid(1), _hiAreaTriggerGuid(1), _expiredMailCursor(0), _skipUpdateCount(1)
 {}
 
 ObjectMgr::~ObjectMgr()
@@ -5377,16 +5377,23 @@ void ObjectMgr::LoadNpcTextLocales()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %lu NpcText locale strings in %u ms", (unsigned long)_npcTextLocaleStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
-//not very fast function but it is called only once a day, or on starting-up
-void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
+// Returns mails with items to their sender and deletes the rest once they expire. At startup the
+// whole backlog is handled at once, while the server is up every call handles one batch of at most
+// MailExpiryBatchSize mails. Returns true if there may be expired mails left for the next call.
+bool ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
     uint32 oldMSTime = getMSTime();
 
     time_t curTime = time(NULL);
-    tm lt;
-    ACE_OS::localtime_r(&curTime, &lt);
     uint64 basetime(curTime);
-    sLog->outInfo(LOG_FILTER_GENERAL, "Returning mails current time: hour: %d, minute: %d, second: %d ", lt.tm_hour, lt.tm_min, lt.tm_sec);
+
+    // a pass starts with the first batch, do not log every following one
+    if (!_expiredMailCursor)
+    {
+        tm lt;
+        ACE_OS::localtime_r(&curTime, &lt);
+        sLog->outInfo(LOG_FILTER_GENERAL, "Returning mails current time: hour: %d, minute: %d, second: %d ", lt.tm_hour, lt.tm_min, lt.tm_sec);
+    }
 
     // Delete all old mails without item and without body immediately, if starting server
     if (!serverUp)
@@ -5395,34 +5402,51 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         stmt->setUInt64(0, basetime);
         CharacterDatabase.Execute(stmt);
     }
+
+    uint32 batchSize = sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_BATCH_SIZE);
+    if (!batchSize)
+        batchSize = std::numeric_limits<uint32>::max();
+
+    uint32 deletedCount = 0;
+    uint32 returnedCount = 0;
+    bool pending;
+    do
+        pending = ReturnOrDeleteOldMailsBatch(basetime, serverUp, batchSize, deletedCount, returnedCount);
+    while (pending && !serverUp);
+
+    if (!serverUp)
+    {
+        if (deletedCount + returnedCount)
+            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+        else
+            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> No expired mails found.");
+    }
+    else if (deletedCount + returnedCount)
+        sLog->outDebug(LOG_FILTER_GENERAL, "ObjectMgr::ReturnOrDeleteOldMails: %u deleted and %u returned in %u ms%s", deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime), pending ? ", more pending" : "");
+
+    return pending;
+}
+
+// handles the next batchSize expired mails after _expiredMailCursor, returns false once all are done
+bool ObjectMgr::ReturnOrDeleteOldMailsBatch(uint64 basetime, bool serverUp, uint32 batchSize, uint32& deletedCount, uint32& returnedCount)
+{
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
     stmt->setUInt64(0, basetime);
+    stmt->setUInt32(1, _expiredMailCursor);
+    stmt->setUInt32(2, batchSize);
     PreparedQueryResult result = CharacterDatabase.Query(stmt);
     if (!result)
     {
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> No expired mails found.");
-        return;                                             // any mails need to be returned or deleted
+        _expiredMailCursor = 0;
+        return false;                                       // any mails need to be returned or deleted
     }
 
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->setUInt32(0, (uint32)basetime);
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
-    {
-        MailItemInfo item;
-        do
-        {
-            Field* fields = items->Fetch();
-            item.item_guid = fields[0].GetUInt32();
-            item.item_template = fields[1].GetUInt32();
-            uint32 mailId = fields[2].GetUInt32();
-            itemsCache[mailId].push_back(item);
-        }
-        while (items->NextRow());
-    }
+    bool pending = result->GetRowCount() >= batchSize;
+    uint32 firstMailId = _expiredMailCursor;
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
+    std::vector<Mail*> mails;
+    mails.reserve(size_t(result->GetRowCount()));
+    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache; // only mails with items have an entry
     do
     {
         Field* fields = result->Fetch();
@@ -5438,6 +5462,9 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         m->checked        = fields[7].GetUInt8();
         m->mailTemplateId = fields[8].GetInt16();
 
+        // rows come ordered by id, the next batch continues after this one even if mails are skipped below
+        _expiredMailCursor = m->messageID;
+
         Player* player = NULL;
         if (serverUp)
             player = ObjectAccessor::FindPlayer((uint64)m->receiver);
@@ -5449,11 +5476,47 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             continue;
         }
 
-        // Delete or return mail
         if (has_items)
+            itemsCache[m->messageID];
+
+        mails.push_back(m);
+    }
+    while (result->NextRow());
+
+    if (!pending)
+        _expiredMailCursor = 0;
+
+    // items of the whole batch in one query
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+    stmt->setUInt32(0, (uint32)basetime);
+    stmt->setUInt32(1, firstMailId);
+    stmt->setUInt32(2, mails.empty() ? firstMailId : mails.back()->messageID);
+    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
+    {
+        MailItemInfo item;
+        do
+        {
+            Field* fields = items->Fetch();
+            item.item_guid = fields[0].GetUInt32();
+            item.item_template = fields[1].GetUInt32();
+            std::map<uint32, MailItemInfoVec>::iterator itr = itemsCache.find(fields[2].GetUInt32());
+            if (itr != itemsCache.end())
+                itr->second.push_back(item);
+        }
+        while (items->NextRow());
+    }
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    for (std::vector<Mail*>::iterator itr = mails.begin(); itr != mails.end(); ++itr)
+    {
+        Mail* m = *itr;
+
+        // Delete or return mail
+        std::map<uint32, MailItemInfoVec>::iterator items = itemsCache.find(m->messageID);
+        if (items != itemsCache.end())
         {
             // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
+            m->items.swap(items->second);
 
             // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
             if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
@@ -5463,7 +5526,7 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                 {
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
                     stmt->setUInt32(0, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
             }
             else
@@ -5476,19 +5539,19 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                 stmt->setUInt32(3, basetime);
                 stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
                 stmt->setUInt32(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
                 {
                     // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
                     stmt->setUInt32(0, m->sender);
                     stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
 
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
                     stmt->setUInt32(0, m->sender);
                     stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
                 delete m;
                 ++returnedCount;
@@ -5498,13 +5561,13 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
         stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
         delete m;
         ++deletedCount;
     }
-    while (result->NextRow());
+    CharacterDatabase.CommitTransaction(trans);
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    return pending;
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
@@ -1023,7 +1023,7 @@ class ObjectMgr
             return itr != _fishingBaseForAreaStore.end() ? itr->second : 0;
         }
 
-        void ReturnOrDeleteOldMails(bool serverUp);
+        bool ReturnOrDeleteOldMails(bool serverUp);
 
         CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1338,6 +1338,8 @@ class ObjectMgr
         uint32 _hiAreaTriggerGuid;
         uint32 _hiMoTransGuid;
 
+        uint32 _expiredMailCursor;                          // last mail id handled by ReturnOrDeleteOldMails in the current pass
+
         QuestMap _questTemplates;
 
         typedef UNORDERED_MAP<uint32, GossipText> GossipTextContainer;
@@ -1404,6 +1406,7 @@ class ObjectMgr
         void CheckScripts(ScriptsType type, std::set<int32>& ids);
         void LoadQuestRelationsHelper(QuestRelations& map, std::string table, bool starter, bool go);
         void PlayerCreateInfoAddItemHelper(uint32 race_, uint32 class_, uint32 itemId, int32 count);
+        bool ReturnOrDeleteOldMailsBatch(uint64 basetime, bool serverUp, uint32 batchSize, uint32& deletedCount, uint32& returnedCount);
 
         MailLevelRewardContainer _mailLevelRewardStore;
 
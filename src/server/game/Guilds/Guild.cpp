@@ -494,10 +494,19 @@ void Guild::BankTab::Delete(SQLTransaction& trans, bool removeItemsFromDB)
             if (removeItemsFromDB)
                 pItem->DeleteFromDB(trans);
             delete pItem;
-            pItem = NULL;
+            m_items[slotId] = NULL;
         }
 }
 
+uint32 Guild::BankTab::GetItemCount() const
+{
+    uint32 count = 0;
+    for (uint8 slotId = 0; slotId < GUILD_BANK_MAX_SLOTS; ++slotId)
+        if (m_items[slotId])
+            ++count;
+    return count;
+}
+
 void Guild::BankTab::SetInfo(const std::string& name, const std::string& icon)
 {
     if (m_name == name && m_icon == icon)
@@ -590,6 +599,7 @@ void Guild::Member::SetStats(Player* player)
     m_class     = player->getClass();
     m_zoneId    = player->GetZoneId();
     m_accountId = player->GetSession()->GetAccountId();
+    m_rosterDataDirty = true;
 }
 
 void Guild::Member::SetStats(const std::string& name, uint8 level, uint8 _class, uint32 zoneId, uint32 accountId)
@@ -599,6 +609,7 @@ void Guild::Member::SetStats(const std::string& name, uint8 level, uint8 _class,
     m_class     = _class;
     m_zoneId    = zoneId;
     m_accountId = accountId;
+    m_rosterDataDirty = true;
 }
 
 void Guild::Member::SetPublicNote(const std::string& publicNote)
@@ -607,6 +618,7 @@ void Guild::Member::SetPublicNote(const std::string& publicNote)
         return;
 
     m_publicNote = publicNote;
+    m_rosterDataDirty = true;
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_PNOTE);
     stmt->setString(0, publicNote);
@@ -620,6 +632,7 @@ void Guild::Member::SetOfficerNote(const std::string& officerNote)
         return;
 
     m_officerNote = officerNote;
+    m_rosterDataDirty = true;
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_OFFNOTE);
     stmt->setString(0, officerNote);
@@ -630,6 +643,7 @@ void Guild::Member::SetOfficerNote(const std::string& officerNote)
 void Guild::Member::ChangeRank(uint8 newRank)
 {
     m_rankId = newRank;
+    m_rosterDataDirty = true;
 
     // Update rank information in player's field, if he is online.
     if (Player* player = FindPlayer())
@@ -1142,7 +1156,7 @@ InventoryResult Guild::BankMoveItemData::CanStore(Item* pItem, bool swap)
 ///////////////////////////////////////////////////////////////////////////////
 // Guild
 Guild::Guild() : m_id(0), m_leaderGuid(0), m_createdDate(0), m_accountsNumber(0), m_bankMoney(0), m_eventLog(NULL),
-    m_achievementMgr(this), _level(1), _experience(0), _todayExperience(0), _newsLog(this)
+    m_eventLogsLoaded(false), m_bankItemsLoaded(false), m_contentAccessTime(0), m_achievementMgr(this), _level(1), _experience(0), _todayExperience(0), _newsLog(this)
 {
     memset(&m_bankEventLog, 0, (GUILD_BANK_MAX_TABS + 1) * sizeof(LogHolder*));
 }
@@ -1194,6 +1208,11 @@ bool Guild::Create(Player* pLeader, const std::string& name)
     _level = 1;
     _CreateLogHolders();
 
+    // nothing to load for a new guild
+    m_eventLogsLoaded = true;
+    m_bankItemsLoaded = true;
+    m_contentAccessTime = m_createdDate;
+
     sLog->outDebug(LOG_FILTER_GUILD, "GUILD: creating guild [%s] for leader %s (%u)",
         name.c_str(), pLeader->GetName(), GUID_LOPART(m_leaderGuid));
 
@@ -1271,6 +1290,7 @@ void Guild::Disband()
     trans->Append(stmt);
 
     // Free bank tab used memory and delete items stored in them
+    _LoadBankItems();
     _DeleteBankItems(trans, true);
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_ITEMS);
@@ -1351,9 +1371,108 @@ bool Guild::SetName(std::string const& name)
     return true;
 }
 
+void Guild::Member::WriteRosterData(ByteBuffer& memberData, Player* player)
+{
+    // online members show live data (zone, reputation, professions...), build it every time
+    if (player)
+    {
+        _BuildRosterData(memberData, player, NULL);
+        return;
+    }
+
+    if (m_rosterDataDirty)
+    {
+        m_rosterData.clear();
+        _BuildRosterData(m_rosterData, NULL, &m_rosterLogoutPos);
+        m_rosterDataDirty = false;
+    }
+
+    size_t pos = memberData.wpos();
+    memberData.append(m_rosterData);
+    memberData.put<float>(pos + m_rosterLogoutPos, float(::time(NULL) - m_logoutTime) / DAY);
+}
+
+void Guild::Member::_BuildRosterData(ByteBuffer& memberData, Player* player, size_t* logoutPos) const
+{
+    ObjectGuid guid = m_guid;
+
+    uint8 flags = GUILDMEMBER_STATUS_NONE;
+    if (player)
+    {
+        flags |= GUILDMEMBER_STATUS_ONLINE;
+        if (player->isAFK())
+            flags |= GUILDMEMBER_STATUS_AFK;
+        if (player->isDND())
+            flags |= GUILDMEMBER_STATUS_DND;
+    }
+
+    memberData << uint32(player ? player->GetReputation(REP_GUILD) : 0);
+    memberData << uint8(m_class);
+    memberData << uint8(m_level);
+    memberData << uint32(0); // sWorld->getIntConfig(CONFIG_GUILD_WEEKLY_REP_CAP)
+    memberData << uint64(0); // Total activity
+    memberData.WriteString(m_publicNote);
+    memberData.WriteByteSeq(guid[1]);
+    if (logoutPos)
+        *logoutPos = memberData.wpos();
+    memberData << float(player ? 0.0f : float(::time(NULL) - m_logoutTime) / DAY);
+    memberData.WriteByteSeq(guid[2]);
+    memberData.WriteByteSeq(guid[4]);
+    memberData << uint32(player ? player->GetZoneId() : GetZoneId());
+    memberData << uint8(1);
+    memberData << uint32(50528283);
+    memberData.WriteByteSeq(guid[7]);
+    memberData.WriteByteSeq(guid[5]);
+    memberData << uint32(player ? player->GetAchievementMgr().GetAchievementPoints() : 0);
+    memberData.WriteByteSeq(guid[3]);
+    memberData << uint8(flags);
+    memberData.WriteByteSeq(guid[6]);
+    memberData << uint64(0); // Weekly activity
+    memberData.WriteString(m_name);
+    memberData.WriteString(m_officerNote);
+
+    // for (2 professions)
+    for (int i = 0; i < 2; ++i)
+    {
+        uint32 id = player ? player->GetUInt32Value(PLAYER_PROFESSION_SKILL_LINE_1 + i) : 0;
+
+        if (id)
+            memberData << uint32(id) << uint32(player->GetSkillValue(id)) << uint32(player->GetSkillStep(id));
+        else
+            memberData << uint32(0) << uint32(0) << uint32(0);
+    }
+
+    memberData.WriteByteSeq(guid[0]);
+    memberData << uint32(m_rankId);
+}
+
 void Guild::HandleRoster(WorldSession* session /*= NULL*/)
+{
+    // broadcasts are collected by GuildMgr, several changes in one world update only send the roster once
+    if (!session)
+    {
+        sGuildMgr->ScheduleRosterBroadcast(GetId());
+        return;
+    }
+
+    WorldPacket data(SMSG_GUILD_ROSTER, 100);
+    _BuildRoster(data);
+    session->SendPacket(&data);
+
+    sLog->outDebug(LOG_FILTER_GUILD, "WORLD: Sent (SMSG_GUILD_ROSTER)");
+}
+
+void Guild::BroadcastRoster()
 {
     WorldPacket data(SMSG_GUILD_ROSTER, 100);
+    _BuildRoster(data);
+    BroadcastPacket(&data);
+
+    sLog->outDebug(LOG_FILTER_GUILD, "WORLD: Sent (SMSG_GUILD_ROSTER) to all members");
+}
+
+void Guild::_BuildRoster(WorldPacket& data)
+{
     ByteBuffer memberData;
 
     data << uint32(0);
@@ -1372,16 +1491,6 @@ void Guild::HandleRoster(WorldSession* session /*= NULL*/)
         size_t pubNoteLength = member->GetPublicNote().length();
         size_t offNoteLength = member->GetOfficerNote().length();
 
-        uint8 flags = GUILDMEMBER_STATUS_NONE;
-        if (player)
-        {
-            flags |= GUILDMEMBER_STATUS_ONLINE;
-            if (player->isAFK())
-                flags |= GUILDMEMBER_STATUS_AFK;
-            if (player->isDND())
-                flags |= GUILDMEMBER_STATUS_DND;
-        }
-
         ObjectGuid guid = member->GetGUID();
 
         data.WriteBit(0); // Can Scroll of Ressurect
@@ -1398,43 +1507,7 @@ void Guild::HandleRoster(WorldSession* session /*= NULL*/)
         data.WriteBit(guid[3]);
         data.WriteBit(guid[0]);
 
-
-        memberData << uint32(player ? player->GetReputation(REP_GUILD) : 0);
-        memberData << uint8(member->GetClass());
-        memberData << uint8(member->GetLevel());
-        memberData << uint32(0); // sWorld->getIntConfig(CONFIG_GUILD_WEEKLY_REP_CAP)
-        memberData << uint64(0); // Total activity
-        memberData.WriteString(member->GetPublicNote());
-        memberData.WriteByteSeq(guid[1]);
-        memberData << float(player ? 0.0f : float(::time(NULL) - member->GetLogoutTime()) / DAY);
-        memberData.WriteByteSeq(guid[2]);
-        memberData.WriteByteSeq(guid[4]);
-        memberData << uint32(player ? player->GetZoneId() : member->GetZoneId());
-        memberData << uint8(1);
-        memberData << uint32(50528283);
-        memberData.WriteByteSeq(guid[7]);
-        memberData.WriteByteSeq(guid[5]);
-        memberData << uint32(player ? player->GetAchievementMgr().GetAchievementPoints() : 0);
-        memberData.WriteByteSeq(guid[3]);
-        memberData << uint8(flags);
-        memberData.WriteByteSeq(guid[6]);
-        memberData << uint64(0); // Weekly activity
-        memberData.WriteString(member->GetName());
-        memberData.WriteString(member->GetOfficerNote());
-            
-        // for (2 professions)
-        for (int i = 0; i < 2; ++i)
-        {
-            uint32 id = player ? player->GetUInt32Value(PLAYER_PROFESSION_SKILL_LINE_1 + i) : 0;
-
-            if (id)
-                memberData << uint32(id) << uint32(player->GetSkillValue(id)) << uint32(player->GetSkillStep(id));
-            else
-                memberData << uint32(0) << uint32(0) << uint32(0);
-        }
-        
-        memberData.WriteByteSeq(guid[0]);
-        memberData << uint32(member->GetRankId());
+        member->WriteRosterData(memberData, player);
     }
 
     data.FlushBits();
@@ -1442,13 +1515,6 @@ void Guild::HandleRoster(WorldSession* session /*= NULL*/)
 
     data.WriteString(m_info);
     data.WriteString(m_motd);
-
-    if (session)
-        session->SendPacket(&data);
-    else
-        BroadcastPacket(&data);
-
-    sLog->outDebug(LOG_FILTER_GUILD, "WORLD: Sent (SMSG_GUILD_ROSTER)");
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -2297,19 +2363,23 @@ void Guild::HandleGuildPartyRequest(WorldSession* session)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Send data to client
-void Guild::SendEventLog(WorldSession* session) const
+void Guild::SendEventLog(WorldSession* session)
 {
+    _LoadEventLogs();
+
     WorldPacket data(SMSG_GUILD_EVENT_LOG_QUERY_RESULT);
     m_eventLog->WritePacket(data, false, false);
     session->SendPacket(&data);
     sLog->outDebug(LOG_FILTER_GUILD, "WORLD: Sent (SMSG_GUILD_EVENT_LOG_QUERY_RESULT)");
 }
 
-void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
+void Guild::SendBankLog(WorldSession* session, uint8 tabId)
 {
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
+        _LoadEventLogs();
+
         LogHolder const* log = m_bankEventLog[tabId];
         WorldPacket data(SMSG_GUILD_BANK_LOG_QUERY_RESULT);
         bool hasCashFlow = GetLevel() >= 5 && tabId == GUILD_BANK_MAX_TABS;
@@ -2323,11 +2393,13 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
     }
 }
 
-void Guild::SendBankList(WorldSession* session, uint8 tabId, bool withContent, bool withTabInfo) const
+void Guild::SendBankList(WorldSession* session, uint8 tabId, bool withContent, bool withTabInfo)
 {
     uint32 itemCount = 0;
     if (withContent)
     {
+        _LoadBankItems();
+
         if (_MemberHasTabRights(session->GetPlayer()->GetGUID(), tabId, GUILD_BANK_RIGHT_VIEW_TAB))
         {
             if (BankTab const* tab = GetBankTab(tabId))
@@ -2783,6 +2855,47 @@ bool Guild::LoadBankItemFromDB(Field* fields)
     return m_bankTabs[tabId]->LoadItemFromDB(fields);
 }
 
+// Frees bank items and event logs, everything in them is already saved and they are loaded again on next use
+bool Guild::UnloadIdleContent(time_t idleBefore)
+{
+    if (!IsContentLoaded() || m_contentAccessTime >= idleBefore)
+        return false;
+
+    if (m_bankItemsLoaded)
+    {
+        SQLTransaction temp(NULL);
+        for (uint8 tabId = 0; tabId < GetPurchasedTabsSize(); ++tabId)
+            m_bankTabs[tabId]->Delete(temp);
+        m_bankItemsLoaded = false;
+    }
+
+    if (m_eventLogsLoaded)
+    {
+        delete m_eventLog;
+        for (uint8 tabId = 0; tabId <= GUILD_BANK_MAX_TABS; ++tabId)
+            delete m_bankEventLog[tabId];
+        _CreateLogHolders();
+        m_eventLogsLoaded = false;
+    }
+    return true;
+}
+
+uint32 Guild::GetLoadedBankItemCount() const
+{
+    uint32 count = 0;
+    for (uint8 tabId = 0; tabId < GetPurchasedTabsSize(); ++tabId)
+        count += m_bankTabs[tabId]->GetItemCount();
+    return count;
+}
+
+uint32 Guild::GetLoadedLogEntryCount() const
+{
+    uint32 count = m_eventLog->GetSize();
+    for (uint8 tabId = 0; tabId <= GUILD_BANK_MAX_TABS; ++tabId)
+        count += m_bankEventLog[tabId]->GetSize();
+    return count;
+}
+
 // Validates guild data loaded from database. Returns false if guild should be deleted.
 bool Guild::Validate()
 {
@@ -3079,6 +3192,8 @@ void Guild::SwapItems(Player* player, uint8 tabId, uint8 slotId, uint8 destTabId
     if (tabId == destTabId && slotId == destSlotId)
         return;
 
+    _LoadBankItems();
+
     BankMoveItemData from(this, player, tabId, slotId);
     BankMoveItemData to(this, player, destTabId, destSlotId);
     _MoveItems(&from, &to, splitedAmount);
@@ -3089,6 +3204,8 @@ void Guild::SwapItemsWithInventory(Player* player, bool toChar, uint8 tabId, uin
     if ((slotId >= GUILD_BANK_MAX_SLOTS && slotId != NULL_SLOT) || tabId >= GetPurchasedTabsSize())
         return;
 
+    _LoadBankItems();
+
     BankMoveItemData bankData(this, player, tabId, slotId);
     PlayerMoveItemData charData(this, player, playerBag, playerSlotId);
     if (toChar)
@@ -3102,6 +3219,8 @@ void Guild::AutoStoreItemInInventory(Player* player, uint8 tabId, uint8 slotId,
     if ((slotId >= GUILD_BANK_MAX_SLOTS && slotId != NULL_SLOT) || tabId >= GetPurchasedTabsSize())
         return;
 
+    _LoadBankItems();
+
     Item* item = _GetItem(tabId, slotId);
     if (!item)
     {
@@ -3154,6 +3273,51 @@ void Guild::_CreateLogHolders()
         m_bankEventLog[tabId] = new LogHolder(m_id, sWorld->getIntConfig(CONFIG_GUILD_BANK_EVENT_LOG_COUNT));
 }
 
+void Guild::_LoadEventLogs()
+{
+    m_contentAccessTime = time(NULL);
+    if (m_eventLogsLoaded)
+        return;
+
+    m_eventLogsLoaded = true;
+
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_EVENTLOG);
+    stmt->setUInt32(0, m_id);
+    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    {
+        do
+            LoadEventLogFromDB(result->Fetch());
+        while (result->NextRow());
+    }
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_BANK_EVENTLOG);
+    stmt->setUInt32(0, m_id);
+    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    {
+        do
+            LoadBankEventLogFromDB(result->Fetch());
+        while (result->NextRow());
+    }
+}
+
+void Guild::_LoadBankItems()
+{
+    m_contentAccessTime = time(NULL);
+    if (m_bankItemsLoaded)
+        return;
+
+    m_bankItemsLoaded = true;
+
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_BANK_ITEMS);
+    stmt->setUInt32(0, m_id);
+    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    {
+        do
+            LoadBankItemFromDB(result->Fetch());
+        while (result->NextRow());
+    }
+}
+
 bool Guild::_CreateNewBankTab()
 {
     if (GetPurchasedTabsSize() >= GUILD_BANK_MAX_TABS)
@@ -3393,6 +3557,8 @@ inline bool Guild::_MemberHasTabRights(uint64 guid, uint8 tabId, uint32 rights)
 // Add new event log record
 inline void Guild::_LogEvent(GuildEventLogTypes eventType, uint32 playerGuid1, uint32 playerGuid2, uint8 newRank)
 {
+    _LoadEventLogs();
+
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
     m_eventLog->AddEvent(trans, new EventLogEntry(m_id, m_eventLog->GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank));
     CharacterDatabase.CommitTransaction(trans);
@@ -3416,6 +3582,9 @@ void Guild::_LogBankEvent(SQLTransaction& trans, GuildBankEventLogTypes eventTyp
         tabId = GUILD_BANK_MAX_TABS;
         dbTabId = GUILD_BANK_MONEY_LOGS_TAB;
     }
+
+    _LoadEventLogs();
+
     LogHolder* pLog = m_bankEventLog[tabId];
     pLog->AddEvent(trans, new BankEventLogEntry(m_id, pLog->GetNextGUID(), eventType, dbTabId, lowguid, itemOrMoney, itemStackCount, destTabId));
 
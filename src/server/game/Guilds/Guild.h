@@ -429,7 +429,10 @@ class Guild
                     m_totalActivity(0),
                     m_weekActivity(0),
                     m_totalReputation(0),
-                    m_weekReputation(0) { }
+                    m_weekReputation(0),
+                    m_rosterData(0),                        // only sized once the entry is first built
+                    m_rosterLogoutPos(0),
+                    m_rosterDataDirty(true) { }
 
                 void SetStats(Player* player);
                 void SetStats(const std::string& name, uint8 level, uint8 _class, uint32 zoneId, uint32 accountId);
@@ -441,8 +444,8 @@ class Guild
                 std::string GetPublicNote() { return m_publicNote; };
                 std::string GetOfficerNote() { return m_officerNote; };
 
-                void SetZoneId(uint32 id) { m_zoneId = id; }
-                void SetLevel(uint8 var) { m_level = var; }
+                void SetZoneId(uint32 id) { m_zoneId = id; m_rosterDataDirty = true; }
+                void SetLevel(uint8 var) { m_level = var; m_rosterDataDirty = true; }
 
                 bool LoadFromDB(Field* fields);
                 void SaveToDB(SQLTransaction& trans) const;
@@ -458,7 +461,7 @@ class Guild
                 uint8 GetLevel() const { return m_level; }
                 uint8 GetZoneId() const { return m_zoneId; }
 
-                inline void UpdateLogoutTime() { m_logoutTime = ::time(NULL); }
+                inline void UpdateLogoutTime() { m_logoutTime = ::time(NULL); m_rosterDataDirty = true; }
                 uint64 GetLogoutTime() const { return m_logoutTime; }
 
                 inline Player* FindPlayer() const { return ObjectAccessor::FindPlayer(m_guid); }
@@ -489,7 +492,12 @@ class Guild
                 void SetWeeklyReputation(uint32 value) { m_weekReputation = value; }
                 uint32 GetWeeklyReputation() const { return m_weekReputation; }
 
+                // Roster.
+                void WriteRosterData(ByteBuffer& memberData, Player* player);
+
             private:
+                void _BuildRosterData(ByteBuffer& memberData, Player* player, size_t* logoutPos) const;
+
                 uint32 m_guildId;
 
                 // Fields from characters table.
@@ -514,6 +522,11 @@ class Guild
                 uint64 m_weekActivity;
                 uint32 m_totalReputation;
                 uint32 m_weekReputation;
+
+                // SMSG_GUILD_ROSTER entry while offline, rebuilt after any change of the fields it holds
+                ByteBuffer m_rosterData;
+                size_t m_rosterLogoutPos;                   // days since logout in m_rosterData, written when sent
+                bool m_rosterDataDirty;
         };
 
         // News Log class
@@ -713,6 +726,7 @@ class Guild
                 std::string const& GetText() const { return m_text; }
 
                 inline Item* GetItem(uint8 slotId) const { return slotId < GUILD_BANK_MAX_SLOTS ?  m_items[slotId] : NULL; }
+                uint32 GetItemCount() const;
                 bool SetItem(SQLTransaction& trans, uint8 slotId, Item* item);
 
             private:
@@ -838,7 +852,8 @@ class Guild
         bool SetName(std::string const& name);
 
         // Handle client commands
-        void HandleRoster(WorldSession* session = NULL);          // NULL = broadcast
+        void HandleRoster(WorldSession* session = NULL);          // NULL = broadcast, sent once per world update by GuildMgr
+        void BroadcastRoster();
         void HandleQuery(WorldSession* session);
         void HandleGuildRanks(WorldSession* session) const;
         void HandleSetMOTD(WorldSession* session, const std::string& motd);
@@ -868,9 +883,9 @@ class Guild
         void UpdateMemberData(Player* player, uint8 dataid, uint32 value);
 
         // Send info to client
-        void SendEventLog(WorldSession* session) const;
-        void SendBankLog(WorldSession* session, uint8 tabId) const;
-        void SendBankList(WorldSession* session, uint8 tabId, bool withContent, bool withTabInfo) const;
+        void SendEventLog(WorldSession* session);
+        void SendBankLog(WorldSession* session, uint8 tabId);
+        void SendBankList(WorldSession* session, uint8 tabId, bool withContent, bool withTabInfo);
         void SendBankTabText(WorldSession* session, uint8 tabId) const;
         void SendPermissions(WorldSession* session) const;
         void SendMoneyInfo(WorldSession* session) const;
@@ -891,6 +906,12 @@ class Guild
         bool LoadBankItemFromDB(Field* fields);
         bool Validate();
 
+        // Bank items and event logs are loaded on first use, and unloaded again once not used since idleBefore
+        bool UnloadIdleContent(time_t idleBefore);
+        bool IsContentLoaded() const { return m_bankItemsLoaded || m_eventLogsLoaded; }
+        uint32 GetLoadedBankItemCount() const;
+        uint32 GetLoadedLogEntryCount() const;
+
         void DepositMoney(uint64 amount);
 
         // Broadcasts
@@ -977,6 +998,10 @@ class Guild
         LogHolder* m_eventLog;
         LogHolder* m_bankEventLog[GUILD_BANK_MAX_TABS + 1];
 
+        bool m_eventLogsLoaded;
+        bool m_bankItemsLoaded;
+        time_t m_contentAccessTime;
+
         AchievementMgr<Guild> m_achievementMgr;
         GuildNewsLog _newsLog;
 
@@ -1022,6 +1047,9 @@ class Guild
 
         // Creates log holders (either when loading or when creating guild)
         void _CreateLogHolders();
+        // Load event logs and bank items from DB the first time they are needed
+        void _LoadEventLogs();
+        void _LoadBankItems();
         // Tries to create new bank tab
         bool _CreateNewBankTab();
         // Creates default guild ranks with names in given locale
@@ -1062,5 +1090,6 @@ class Guild
         void SendGuildRanksUpdate(uint64 setterGuid, uint64 targetGuid, uint32 rank);
 
         void _BroadcastEvent(GuildEvents guildEvent, uint64 guid, const char* param1 = NULL, const char* param2 = NULL, const char* param3 = NULL) const;
+        void _BuildRoster(WorldPacket& data);
 };
 #endif
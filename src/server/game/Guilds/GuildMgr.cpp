@@ -39,6 +39,29 @@ void GuildMgr::RemoveGuild(uint32 guildId)
     GuildStore.erase(guildId);
 }
 
+void GuildMgr::ScheduleRosterBroadcast(uint32 guildId)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, RosterBroadcastsLock);
+    RosterBroadcasts.insert(guildId);
+}
+
+void GuildMgr::SendRosterBroadcasts()
+{
+    std::set<uint32> guildIds;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, RosterBroadcastsLock);
+        if (RosterBroadcasts.empty())
+            return;
+
+        guildIds.swap(RosterBroadcasts);
+    }
+
+    // guilds disbanded in the meantime are not found anymore
+    for (std::set<uint32>::const_iterator itr = guildIds.begin(); itr != guildIds.end(); ++itr)
+        if (Guild* guild = GetGuildById(*itr))
+            guild->BroadcastRoster();
+}
+
 void GuildMgr::SaveGuilds()
 {
     for (GuildContainer::iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
@@ -50,6 +73,37 @@ void GuildMgr::SaveGuilds()
     }
 }
 
+void GuildMgr::UnloadIdleGuildContent()
+{
+    uint32 oldMSTime = getMSTime();
+
+    time_t idleBefore = time(NULL) - time_t(sWorld->getIntConfig(CONFIG_GUILD_CONTENT_UNLOAD_DELAY) * MINUTE);
+    bool unload = sWorld->getIntConfig(CONFIG_GUILD_CONTENT_UNLOAD_DELAY) != 0;
+
+    uint32 unloaded = 0;
+    uint32 loaded = 0;
+    uint32 bankItems = 0;
+    uint32 logEntries = 0;
+    for (GuildContainer::iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+    {
+        Guild* guild = itr->second;
+        if (!guild)
+            continue;
+
+        if (unload && guild->UnloadIdleContent(idleBefore))
+            ++unloaded;
+        else if (guild->IsContentLoaded())
+        {
+            ++loaded;
+            bankItems += guild->GetLoadedBankItemCount();
+            logEntries += guild->GetLoadedLogEntryCount();
+        }
+    }
+
+    sLog->outDebug(LOG_FILTER_GUILD, "GuildMgr::UnloadIdleGuildContent: unloaded %u idle guilds, %u of %u guilds keep %u bank items and %u log entries loaded (%u ms)",
+        unloaded, loaded, uint32(GuildStore.size()), bankItems, logEntries, GetMSTimeDiffToNow(oldMSTime));
+}
+
 uint32 GuildMgr::GenerateGuildId()
 {
     if (NextGuildId >= 0xFFFFFFFE)
@@ -285,71 +339,17 @@ void GuildMgr::LoadGuilds()
         }
     }
 
-    // 5. Load all event logs
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading guild event logs...");
+    // 5-6. Event logs and bank event logs are loaded per guild on first use, only trim them here
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Deleting exceeding guild event logs...");
     {
         uint32 oldMSTime = getMSTime();
 
         CharacterDatabase.DirectPExecute("DELETE FROM guild_eventlog WHERE LogGuid > %u", sWorld->getIntConfig(CONFIG_GUILD_EVENT_LOG_COUNT));
 
-                                                     //          0        1        2          3            4            5        6
-        QueryResult result = CharacterDatabase.Query("SELECT guildid, LogGuid, EventType, PlayerGuid1, PlayerGuid2, NewRank, TimeStamp FROM guild_eventlog ORDER BY TimeStamp DESC, LogGuid DESC");
-
-        if (!result)
-        {
-            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 guild event logs. DB table `guild_eventlog` is empty.");
-        }
-        else
-        {
-            uint32 count = 0;
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guildId = fields[0].GetUInt32();
-
-                if (Guild* guild = GetGuildById(guildId))
-                    guild->LoadEventLogFromDB(fields);
-
-                ++count;
-            }
-            while (result->NextRow());
-
-            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u guild event logs in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
-        }
-    }
-
-    // 6. Load all bank event logs
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading guild bank event logs...");
-    {
-        uint32 oldMSTime = getMSTime();
-
         // Remove log entries that exceed the number of allowed entries per guild
         CharacterDatabase.DirectPExecute("DELETE FROM guild_bank_eventlog WHERE LogGuid > %u", sWorld->getIntConfig(CONFIG_GUILD_BANK_EVENT_LOG_COUNT));
 
-                                                     //          0        1      2        3          4           5            6               7          8
-        QueryResult result = CharacterDatabase.Query("SELECT guildid, TabId, LogGuid, EventType, PlayerGuid, ItemOrMoney, ItemStackCount, DestTabId, TimeStamp FROM guild_bank_eventlog ORDER BY TimeStamp DESC, LogGuid DESC");
-
-        if (!result)
-        {
-            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 guild bank event logs. DB table `guild_bank_eventlog` is empty.");
-        }
-        else
-        {
-            uint32 count = 0;
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guildId = fields[0].GetUInt32();
-
-                if (Guild* guild = GetGuildById(guildId))
-                    guild->LoadBankEventLogFromDB(fields);
-
-                ++count;
-            }
-            while (result->NextRow());
-
-            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u guild bank event logs in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
-        }
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Deleted exceeding guild event logs in %u ms", GetMSTimeDiffToNow(oldMSTime));
     }
 
     // 7. Load all guild bank tabs
@@ -386,40 +386,10 @@ void GuildMgr::LoadGuilds()
         }
     }
 
-    // 8. Fill all guild bank tabs
-    sLog->outInfo(LOG_FILTER_GUILD, "Filling bank tabs with items...");
+    // 8. Bank items are loaded per guild when the bank is opened, only delete orphans here
     {
-        uint32 oldMSTime = getMSTime();
-
         // Delete orphan guild bank items
         CharacterDatabase.DirectExecute("DELETE gbi FROM guild_bank_item gbi LEFT JOIN guild g ON gbi.guildId = g.guildId WHERE g.guildId IS NULL");
-
-                                                     //          0            1                2      3         4        5      6             7                 8           9           10
-        QueryResult result = CharacterDatabase.Query("SELECT creatorGuid, giftCreatorGuid, count, duration, charges, flags, enchantments, randomPropertyId, durability, playedTime, text, "
-                                                     //   11       12     13      14         15
-                                                     "guildid, TabId, SlotId, item_guid, itemEntry FROM guild_bank_item gbi INNER JOIN item_instance ii ON gbi.item_guid = ii.guid");
-
-        if (!result)
-        {
-            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 guild bank tab items. DB table `guild_bank_item` or `item_instance` is empty.");
-        }
-        else
-        {
-            uint32 count = 0;
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guildId = fields[11].GetUInt32();
-
-                if (Guild* guild = GetGuildById(guildId))
-                    guild->LoadBankItemFromDB(fields);
-
-                ++count;
-            }
-            while (result->NextRow());
-
-            sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u guild bank tab items in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
-        }
     }
 
     // 9. Load guild achievements
@@ -44,6 +44,12 @@ public:
     void RemoveGuild(uint32 guildId);
 
     void SaveGuilds();
+    // frees bank items and event logs of guilds that did not use them for Guild.ContentUnloadDelay minutes
+    void UnloadIdleGuildContent();
+
+    // roster broadcasts requested during a world update are sent once, after the sessions are updated
+    void ScheduleRosterBroadcast(uint32 guildId);
+    void SendRosterBroadcasts();
 
     void ResetExperienceCaps();
      void ResetReputationCaps();
@@ -59,6 +65,9 @@ protected:
     GuildContainer GuildStore;
     std::vector<uint64> GuildXPperLevel;
     std::vector<GuildReward> GuildRewards;
+
+    std::set<uint32> RosterBroadcasts;
+    ACE_Thread_Mutex RosterBroadcastsLock;
 };
 
 #define sGuildMgr ACE_Singleton<GuildMgr, ACE_Null_Mutex>::instance()
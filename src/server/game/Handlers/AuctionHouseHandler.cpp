@@ -657,6 +657,7 @@ void WorldSession::HandleAuctionPlaceBid(WorldPacket& recvData)
 
         auction->bidder = player->GetGUIDLow();
         auction->bid = price;
+        auctionHouse->UpdateSearchRecord(auction);
         GetPlayer()->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_AUCTION_BID, price);
 
         PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_AUCTION_BID);
@@ -974,6 +975,25 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recvData)
 
     wstrToLower(wsearchedname);
 
+    // usable checks need the player, those searches stay in this thread
+    if (!usable)
+    {
+        AuctionSearchQuery query;
+        query.AccountId = GetAccountId();
+        query.SearchedName = wsearchedname;
+        query.ListFrom = listfrom;
+        query.LevelMin = levelmin;
+        query.LevelMax = levelmax;
+        query.InventoryType = auctionSlotID;
+        query.ItemClass = auctionMainCategory;
+        query.ItemSubClass = auctionSubCategory;
+        query.Quality = quality;
+        query.Locale = GetSessionDbLocaleIndex();
+
+        if (sAuctionMgr->QueueSearch(auctionHouse, query))
+            return;
+    }
+
     auctionHouse->BuildListAuctionItems(data, _player,
         wsearchedname, listfrom, levelmin, levelmax, usable,
         auctionSlotID, auctionMainCategory, auctionSubCategory, quality,
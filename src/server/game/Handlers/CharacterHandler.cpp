@@ -883,7 +883,7 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder);
+    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder, sWorld->getIntConfig(CONFIG_LOGIN_QUERY_CONNECTIONS));
     PreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_CHARACTER_SPELL);
     stmt->setUInt32(0, GetAccountId());
     _accountSpellCallback = LoginDatabase.AsyncQuery(stmt);
@@ -1328,6 +1328,14 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder, PreparedQueryResu
     if (totalTime > 70)
         sLog->OutSpecialLog("HandlePlayerLogin |****---> time1 : %u | time 2 : %u | time 3 : %u | time 4 : %u | time 5: %u | time 6 : %u | time 7 : %u | time 8 : %u | time 9 : %u | totaltime : %u", time1, time2, time3, time4, time5, time6, time7, time8, time9, totalTime);
 
+    uint32 slowestQuery = 0;
+    for (uint32 i = 1; i < MAX_PLAYER_LOGIN_QUERY; ++i)
+        if (holder->GetQueryTime(i) > holder->GetQueryTime(slowestQuery))
+            slowestQuery = i;
+
+    if (holder->GetQueryTime(slowestQuery) > 70)
+        sLog->OutSpecialLog("HandlePlayerLogin |****---> slowest login query : %u | time : %u", slowestQuery, holder->GetQueryTime(slowestQuery));
+
     // Fix chat with transfert / rename
     sWorld->AddCharacterNameData(pCurrChar->GetGUIDLow(), pCurrChar->GetName(), pCurrChar->getGender(), pCurrChar->getRace(), pCurrChar->getClass(), pCurrChar->getLevel());
 
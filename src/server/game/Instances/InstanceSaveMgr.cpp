@@ -128,6 +128,26 @@ void InstanceSaveManager::DeleteInstanceFromDB(uint32 instanceid)
     // Respawn times should be deleted only when the map gets unloaded
 }
 
+// Same as DeleteInstanceFromDB for many instances, with one query per table. Still direct,
+// the freed instance ids can be used again right away
+void InstanceSaveManager::DeleteInstancesFromDB(std::vector<uint32> const& instanceIds)
+{
+    if (instanceIds.empty())
+        return;
+
+    std::ostringstream ids;
+    for (std::vector<uint32>::const_iterator itr = instanceIds.begin(); itr != instanceIds.end(); ++itr)
+    {
+        if (itr != instanceIds.begin())
+            ids << ',';
+        ids << *itr;
+    }
+
+    CharacterDatabase.DirectPExecute("DELETE FROM instance WHERE id IN (%s)", ids.str().c_str());
+    CharacterDatabase.DirectPExecute("DELETE FROM character_instance WHERE instance IN (%s)", ids.str().c_str());
+    CharacterDatabase.DirectPExecute("DELETE FROM group_instance WHERE instance IN (%s)", ids.str().c_str());
+}
+
 void InstanceSaveManager::RemoveInstanceSave(uint32 InstanceId)
 {
     InstanceSaveHashMap::iterator itr = m_instanceSaveById.find(InstanceId);
@@ -473,18 +493,34 @@ void InstanceSaveManager::Update()
     time_t now = time(NULL);
     time_t t;
 
-    while (!m_resetTimeQueue.empty())
+    uint32 oldMSTime = getMSTime();
+    uint32 batchSize = sWorld->getIntConfig(CONFIG_INSTANCE_RESET_BATCH_SIZE);
+    uint32 resetCount = 0;                                  // single instance resets, limited by batchSize
+    uint32 globalCount = 0;                                 // global resets and warnings, never limited
+    std::vector<uint32> resetInstanceIds;                   // deleted from the db together after the loop
+
+    ResetTimeQueue::iterator itr = m_resetTimeQueue.begin();
+    while (itr != m_resetTimeQueue.end())
     {
-        t = m_resetTimeQueue.begin()->first;
+        t = itr->first;
         if (t >= now)
             break;
 
-        InstResetEvent &event = m_resetTimeQueue.begin()->second;
+        InstResetEvent &event = itr->second;
         if (event.type == 0)
         {
+            // after a restart many of these are due at once, the rest waits for the next updates
+            if (batchSize && resetCount >= batchSize)
+            {
+                ++itr;
+                continue;
+            }
+
             // for individual normal instances, max creature respawn + X hours
-            _ResetInstance(event.mapid, event.instanceId);
-            m_resetTimeQueue.erase(m_resetTimeQueue.begin());
+            if (_ResetInstance(event.mapid, event.instanceId))
+                resetInstanceIds.push_back(event.instanceId);
+            m_resetTimeQueue.erase(itr++);
+            ++resetCount;
         }
         else
         {
@@ -497,9 +533,16 @@ void InstanceSaveManager::Update()
                 ++event.type;
                 ScheduleReset(true, resetTime - ResetTimeDelay[event.type-1], event);
             }
-            m_resetTimeQueue.erase(m_resetTimeQueue.begin());
+            m_resetTimeQueue.erase(itr++);
+            ++globalCount;
         }
     }
+
+    DeleteInstancesFromDB(resetInstanceIds);
+
+    if (resetCount || globalCount)
+        sLog->outDebug(LOG_FILTER_MAPS, "InstanceSaveManager::Update: %u instance resets (%u instances), %u global events in %u ms%s", resetCount,
+            uint32(resetInstanceIds.size()), globalCount, GetMSTimeDiffToNow(oldMSTime), batchSize && resetCount >= batchSize ? ", batch full" : "");
 }
 
 void InstanceSaveManager::_ResetSave(InstanceSaveHashMap::iterator &itr)
@@ -528,19 +571,18 @@ void InstanceSaveManager::_ResetSave(InstanceSaveHashMap::iterator &itr)
     lock_instLists = false;
 }
 
-void InstanceSaveManager::_ResetInstance(uint32 mapid, uint32 instanceId)
+// returns true if the instance has to be deleted from the DB, even if save not loaded
+bool InstanceSaveManager::_ResetInstance(uint32 mapid, uint32 instanceId)
 {
     sLog->outDebug(LOG_FILTER_MAPS, "InstanceSaveMgr::_ResetInstance %u, %u", mapid, instanceId);
     Map const* map = sMapMgr->CreateBaseMap(mapid);
     if (!map->Instanceable())
-        return;
+        return false;
 
     InstanceSaveHashMap::iterator itr = m_instanceSaveById.find(instanceId);
     if (itr != m_instanceSaveById.end())
         _ResetSave(itr);
 
-    DeleteInstanceFromDB(instanceId);                       // even if save not loaded
-
     Map* iMap = ((MapInstanced*)map)->FindInstanceMap(instanceId);
 
     if (iMap && iMap->IsDungeon())
@@ -551,8 +593,9 @@ void InstanceSaveManager::_ResetInstance(uint32 mapid, uint32 instanceId)
     else
         Map::DeleteRespawnTimesInDB(mapid, instanceId);
 
-    // Free up the instance id and allow it to be reused
+    // Free up the instance id and allow it to be reused, the caller deletes it from the DB before any new instance is created
     sMapMgr->FreeInstanceId(instanceId);
+    return true;
 }
 
 void InstanceSaveManager::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool warn, time_t resetTime)
@@ -180,6 +180,7 @@ class InstanceSaveManager
         void RemoveInstanceSave(uint32 InstanceId);
         void UnloadInstanceSave(uint32 InstanceId);
         static void DeleteInstanceFromDB(uint32 instanceid);
+        static void DeleteInstancesFromDB(std::vector<uint32> const& instanceIds);
 
         InstanceSave* GetInstanceSave(uint32 InstanceId);
 
@@ -193,7 +194,7 @@ class InstanceSaveManager
 
     private:
         void _ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool warn, time_t resetTime);
-        void _ResetInstance(uint32 mapid, uint32 instanceId);
+        bool _ResetInstance(uint32 mapid, uint32 instanceId);
         void _ResetSave(InstanceSaveHashMap::iterator &itr);
         // used during global instance resets
         bool lock_instLists;
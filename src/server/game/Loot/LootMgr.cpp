@@ -71,8 +71,11 @@ class LootTemplate::LootGroup                               // A set of loot def
     private:
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+        std::vector<float> ExplicitChanceSums;              // Running sum of the ExplicitlyChanced chances
+        std::vector<uint32> ExplicitNextCertain;            // First ExplicitlyChanced entry from this one on with 100% chance
 
         LootStoreItem const* Roll() const;                 // Rolls an item from the group, returns NULL if all miss their chances
+        uint32 RollExplicitlyChanced(uint32 begin) const;   // Index of the rolled ExplicitlyChanced entry from begin on, size() if all miss
 };
 
 //Remove all data and free all memory
@@ -1308,27 +1311,37 @@ void LootView::WriteData(ObjectGuid guid, LootType lootType, WorldPacket* data)
 void LootTemplate::LootGroup::AddEntry(LootStoreItem& item)
 {
     if (item.chance != 0)
+    {
+        uint32 index = ExplicitlyChanced.size();
         ExplicitlyChanced.push_back(item);
+        ExplicitChanceSums.push_back((index ? ExplicitChanceSums[index - 1] : 0.0f) + item.chance);
+        ExplicitNextCertain.push_back(uint32(-1));
+
+        if (item.chance >= 100.0f)
+            for (int32 i = index; i >= 0 && ExplicitNextCertain[i] == uint32(-1); --i)
+                ExplicitNextCertain[i] = index;
+    }
     else
         EqualChanced.push_back(item);
 }
 
+// Same as walking the entries from begin on and subtracting their chances from the roll
+// until it drops below zero, but with a binary search over the running sums
+uint32 LootTemplate::LootGroup::RollExplicitlyChanced(uint32 begin) const
+{
+    float roll = (float)rand_chance() + (begin ? ExplicitChanceSums[begin - 1] : 0.0f);
+    uint32 index = std::upper_bound(ExplicitChanceSums.begin() + begin, ExplicitChanceSums.end(), roll) - ExplicitChanceSums.begin();
+    return std::min(index, ExplicitNextCertain[begin]);
+}
+
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll() const
 {
     if (!ExplicitlyChanced.empty())                             // First explicitly chanced entries are checked
     {
-        float Roll = (float)rand_chance();
-
-        for (uint32 i = 0; i < ExplicitlyChanced.size(); ++i)   // check each explicitly chanced entry in the template and modify its chance based on quality.
-        {
-            if (ExplicitlyChanced[i].chance >= 100.0f)
-                return &ExplicitlyChanced[i];
-
-            Roll -= ExplicitlyChanced[i].chance;
-            if (Roll < 0)
-                return &ExplicitlyChanced[i];
-        }
+        uint32 index = RollExplicitlyChanced(0);
+        if (index < ExplicitlyChanced.size())
+            return &ExplicitlyChanced[index];
     }
     if (!EqualChanced.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
         return &EqualChanced[irand(0, EqualChanced.size()-1)];
@@ -1375,50 +1388,39 @@ void LootTemplate::LootGroup::CopyConditions(ConditionList /*conditions*/)
 // Rolls an item from the group (if any takes its chance) and adds the item to the loot
 void LootTemplate::LootGroup::Process(Loot& loot, uint16 lootMode) const
 {
-    // build up list of possible drops
-    LootStoreItemList EqualPossibleDrops = EqualChanced;
-    LootStoreItemList ExplicitPossibleDrops = ExplicitlyChanced;
+    // possible drops: explicitly chanced entries that missed their roll are dropped, which always
+    // leaves the entries from ExplicitBegin on; equal chanced entries only lose duplicates, so
+    // EqualPossibleDrops is only built once the first of them has to go
+    uint32 ExplicitBegin = 0;
+    uint32 EqualCount = EqualChanced.size();
+    std::vector<LootStoreItem const*> EqualPossibleDrops;
 
     uint8 uiAttemptCount = 0;
     const uint8 uiMaxAttempts = ExplicitlyChanced.size() + EqualChanced.size();
 
-    while (!ExplicitPossibleDrops.empty() || !EqualPossibleDrops.empty())
+    while (ExplicitBegin < ExplicitlyChanced.size() || EqualCount)
     {
         if (uiAttemptCount == uiMaxAttempts)             // already tried rolling too many times, just abort
             return;
 
-        LootStoreItem* item = NULL;
+        LootStoreItem const* item = NULL;
 
         // begin rolling (normally called via Roll())
-        LootStoreItemList::iterator itr;
+        uint32 index = 0;
         uint8 itemSource = 0;
-        if (!ExplicitPossibleDrops.empty())              // First explicitly chanced entries are checked
+        if (ExplicitBegin < ExplicitlyChanced.size())    // First explicitly chanced entries are checked
         {
             itemSource = 1;
-            float Roll = (float)rand_chance();
-            // check each explicitly chanced entry in the template and modify its chance based on quality
-            for (itr = ExplicitPossibleDrops.begin(); itr != ExplicitPossibleDrops.end(); itr = ExplicitPossibleDrops.erase(itr))
-            {
-                if (itr->chance >= 100.0f)
-                {
-                    item = &*itr;
-                    break;
-                }
-
-                Roll -= itr->chance;
-                if (Roll < 0)
-                {
-                    item = &*itr;
-                    break;
-                }
-            }
+            index = RollExplicitlyChanced(ExplicitBegin);
+            ExplicitBegin = index;
+            if (index < ExplicitlyChanced.size())
+                item = &ExplicitlyChanced[index];
         }
-        if (item == NULL && !EqualPossibleDrops.empty()) // If nothing selected yet - an item is taken from equal-chanced part
+        if (item == NULL && EqualCount)                  // If nothing selected yet - an item is taken from equal-chanced part
         {
             itemSource = 2;
-            itr = EqualPossibleDrops.begin();
-            std::advance(itr, irand(0, EqualPossibleDrops.size()-1));
-            item = &*itr;
+            index = irand(0, EqualCount - 1);
+            item = EqualPossibleDrops.empty() ? &EqualChanced[index] : EqualPossibleDrops[index];
         }
         // finish rolling
 
@@ -1443,11 +1445,15 @@ void LootTemplate::LootGroup::Process(Loot& loot, uint16 lootMode) const
             if (duplicate) // if item->itemid is a duplicate, remove it
                 switch (itemSource)
                 {
-                    case 1: // item came from ExplicitPossibleDrops
-                        ExplicitPossibleDrops.erase(itr);
+                    case 1: // item came from ExplicitlyChanced
+                        ExplicitBegin = index + 1;
                         break;
-                    case 2: // item came from EqualPossibleDrops
-                        EqualPossibleDrops.erase(itr);
+                    case 2: // item came from EqualChanced
+                        if (EqualPossibleDrops.empty())
+                            for (LootStoreItemList::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
+                                EqualPossibleDrops.push_back(&*i);
+                        EqualPossibleDrops.erase(EqualPossibleDrops.begin() + index);
+                        --EqualCount;
                         break;
                 }
             else           // otherwise, add the item and exit the function
@@ -1706,7 +1712,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
         {
             if (i->itemid == uint32(cond->SourceEntry))
             {
-                i->conditions.push_back(cond);
+                ConditionMgr::AddToConditionList(i->conditions, cond);
                 return true;
             }
         }
@@ -1722,7 +1728,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i).itemid == uint32(cond->SourceEntry))
                     {
-                        (*i).conditions.push_back(cond);
+                        ConditionMgr::AddToConditionList((*i).conditions, cond);
                         return true;
                     }
                 }
@@ -1734,7 +1740,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i).itemid == uint32(cond->SourceEntry))
                     {
-                        (*i).conditions.push_back(cond);
+                        ConditionMgr::AddToConditionList((*i).conditions, cond);
                         return true;
                     }
                 }
@@ -206,7 +206,8 @@ _creatureToMoveLock(false), i_mapEntry (sMapStore.LookupEntry(id)), i_spawnMode(
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), i_gridExpiry(expiry),
-i_scriptLock(false)
+i_scriptLock(false), _losCacheGeneration(0), _losCacheHits(0), _losCacheMisses(0),
+_activeCreatureCount(0), _dormantCreatureCount(0), _lastActiveCreatureCount(0), _lastDormantCreatureCount(0)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -515,6 +516,11 @@ void Map::Update(const uint32 t_diff)
     /// update active cells around players and active objects
     resetMarkedCells();
 
+    _lastActiveCreatureCount = _activeCreatureCount;
+    _lastDormantCreatureCount = _dormantCreatureCount;
+    _activeCreatureCount = 0;
+    _dormantCreatureCount = 0;
+
     SkyMistCore::ObjectUpdater updater(t_diff);
     // for creature
     TypeContainerVisitor<SkyMistCore::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
@@ -1822,10 +1828,115 @@ void Map::GetZoneAndAreaIdByAreaFlag(uint32& zoneid, uint32& areaid, uint16 area
     zoneid = entry ? ((entry->zone != 0) ? entry->zone : entry->ID) : 0;
 }
 
+#define LOS_CACHE_GRID_SIZE     0.5f                        // positions closer than this share one cache entry
+#define LOS_CACHE_ENTRY_TTL     2000                        // ms, also covers vmap tiles loaded after the check
+#define LOS_CACHE_MAX_SIZE      16384
+
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const
 {
-    return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
+    if (!sWorld->getBoolConfig(CONFIG_VMAP_LOS_CACHE))
+        return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
+            && _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+
+    int32 coords[6] =
+    {
+        int32(floor(x1 / LOS_CACHE_GRID_SIZE)), int32(floor(y1 / LOS_CACHE_GRID_SIZE)), int32(floor(z1 / LOS_CACHE_GRID_SIZE)),
+        int32(floor(x2 / LOS_CACHE_GRID_SIZE)), int32(floor(y2 / LOS_CACHE_GRID_SIZE)), int32(floor(z2 / LOS_CACHE_GRID_SIZE))
+    };
+
+    uint64 key = phasemask;
+    for (uint8 i = 0; i < 6; ++i)
+        key = key * UI64LIT(1000003) ^ uint32(coords[i]);
+
+    uint32 now = getMSTime();
+    uint32 generation;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, _losCacheLock);
+        generation = _losCacheGeneration;
+        LOSCacheMap::const_iterator itr = _losCache.find(key);
+        if (itr != _losCache.end() && itr->second.phasemask == phasemask &&
+            getMSTimeDiff(itr->second.checkTime, now) < LOS_CACHE_ENTRY_TTL && !memcmp(itr->second.coords, coords, sizeof(coords)))
+        {
+            ++_losCacheHits;
+            return itr->second.result;
+        }
+        ++_losCacheMisses;
+    }
+
+    bool result = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
         && _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, _losCacheLock);
+    // dynamic tree changed during the check, result may already be outdated
+    if (generation != _losCacheGeneration)
+        return result;
+
+    if (_losCache.size() >= LOS_CACHE_MAX_SIZE)
+        _losCache.clear();
+
+    LOSCacheEntry& entry = _losCache[key];
+    memcpy(entry.coords, coords, sizeof(coords));
+    entry.phasemask = phasemask;
+    entry.checkTime = now;
+    entry.result = result;
+    return result;
+}
+
+// Whether the segment between the centers of the cached cells crosses the box
+static bool IsLOSCacheSegmentCrossingBox(int32 const* coords, G3D::Vector3 const& low, G3D::Vector3 const& high)
+{
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    for (uint8 i = 0; i < 3; ++i)
+    {
+        float start = (coords[i] + 0.5f) * LOS_CACHE_GRID_SIZE;
+        float dir = (coords[i + 3] + 0.5f) * LOS_CACHE_GRID_SIZE - start;
+        if (coords[i] == coords[i + 3])
+        {
+            if (start < low[i] || start > high[i])
+                return false;
+            continue;
+        }
+
+        float t1 = (low[i] - start) / dir;
+        float t2 = (high[i] - start) / dir;
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax)
+            return false;
+    }
+
+    return true;
+}
+
+void Map::InvalidateLOSCache(G3D::AABox const& bounds)
+{
+    // cached results are shared by all positions of a cell, widen the box so that
+    // a segment between any two points of the cells is covered by the center one
+    G3D::Vector3 margin(LOS_CACHE_GRID_SIZE, LOS_CACHE_GRID_SIZE, LOS_CACHE_GRID_SIZE);
+    G3D::Vector3 low = bounds.low() - margin;
+    G3D::Vector3 high = bounds.high() + margin;
+
+    TRINITY_GUARD(ACE_Thread_Mutex, _losCacheLock);
+    ++_losCacheGeneration;
+    for (LOSCacheMap::iterator itr = _losCache.begin(); itr != _losCache.end();)
+    {
+        if (IsLOSCacheSegmentCrossingBox(itr->second.coords, low, high))
+            _losCache.erase(itr++);
+        else
+            ++itr;
+    }
+}
+
+void Map::GetLOSCacheStats(uint64& hits, uint64& misses, uint32& size) const
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, _losCacheLock);
+    hits = _losCacheHits;
+    misses = _losCacheMisses;
+    size = _losCache.size();
 }
 
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
@@ -402,6 +402,10 @@ class Map : public GridRefManager<NGridType>
         void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
+
+        // creatures fully updated and skipped as dormant, counted during an update and reported for the last one
+        void CountCreatureUpdate(bool dormant) { ++(dormant ? _dormantCreatureCount : _activeCreatureCount); }
+        void GetCreatureUpdateStats(uint32& active, uint32& dormant) const { active = _lastActiveCreatureCount; dormant = _lastDormantCreatureCount; }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(NGridType const& ngrid) const;
 
@@ -453,8 +457,12 @@ class Map : public GridRefManager<NGridType>
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const;
         void Balance() { _dynamicTree.balance(); }
-        void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-        void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
+        void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); InvalidateLOSCache(model.getBounds()); }
+        void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); InvalidateLOSCache(model.getBounds()); }
+        // must be called whenever the dynamic tree content changes (doors, transports...),
+        // cached LoS results whose segment crosses the given bounds are dropped
+        void InvalidateLOSCache(G3D::AABox const& bounds);
+        void GetLOSCacheStats(uint64& hits, uint64& misses, uint32& size) const;
         bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
         bool getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float &ry, float& rz, float modifyDist);
 
@@ -553,6 +561,27 @@ class Map : public GridRefManager<NGridType>
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
 
+        // Line of sight cache, key is a hash of the quantized positions, collisions are detected by comparing coords
+        struct LOSCacheEntry
+        {
+            int32 coords[6];
+            uint32 phasemask;
+            uint32 checkTime;
+            bool result;
+        };
+        typedef UNORDERED_MAP<uint64, LOSCacheEntry> LOSCacheMap;
+
+        mutable LOSCacheMap _losCache;
+        mutable ACE_Thread_Mutex _losCacheLock;
+        uint32 _losCacheGeneration;                         // bumped by every invalidation, checks running meanwhile aren't stored
+        mutable uint64 _losCacheHits;
+        mutable uint64 _losCacheMisses;
+
+        uint32 _activeCreatureCount;
+        uint32 _dormantCreatureCount;
+        uint32 _lastActiveCreatureCount;
+        uint32 _lastDormantCreatureCount;
+
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
 
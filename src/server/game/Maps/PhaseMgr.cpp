@@ -24,7 +24,7 @@
 //////////////////////////////////////////////////////////////////
 // Updating
 
-PhaseMgr::PhaseMgr(Player* _player) : player(_player), phaseData(_player), _UpdateFlags(0)
+PhaseMgr::PhaseMgr(Player* _player) : player(_player), phaseData(_player), _UpdateFlags(0), _DefinitionChecksZoneId(0)
 {
     _PhaseDefinitionStore = sObjectMgr->GetPhaseDefinitionStore();
     _SpellPhaseStore = sObjectMgr->GetSpellPhaseStore();
@@ -69,11 +69,41 @@ void PhaseMgr::RemoveUpdateFlag(PhaseUpdateFlag updateFlag)
 
 void PhaseMgr::NotifyConditionChanged(PhaseUpdateData const& updateData)
 {
-    if (NeedsPhaseUpdateWithData(updateData))
+    PhaseDefinitionStore::const_iterator itr = _PhaseDefinitionStore->find(player->GetZoneId());
+    if (itr == _PhaseDefinitionStore->end())
+        return;
+
+    // definitions with a condition depending on the change are checked again, as well as
+    // definitions with conditions that never notify a change
+    bool related = false;
+    if (_DefinitionChecksZoneId == player->GetZoneId() && _DefinitionChecks.size() == itr->second.size())
     {
-        Recalculate();
-        Update();
+        uint32 index = 0;
+        for (PhaseDefinitionContainer::const_iterator phase = itr->second.begin(); phase != itr->second.end(); ++phase, ++index)
+        {
+            if (IsDefinitionRelated(&(*phase), updateData))
+            {
+                _DefinitionChecks[index] = DEFINITION_CHECK_NONE;
+                related = true;
+            }
+            else if (!IsDefinitionCacheable(&(*phase)))
+                _DefinitionChecks[index] = DEFINITION_CHECK_NONE;
+        }
+
+        if (related)
+            ApplyDefinitions(itr->second);
     }
+    else
+    {
+        for (PhaseDefinitionContainer::const_iterator phase = itr->second.begin(); phase != itr->second.end() && !related; ++phase)
+            related = IsDefinitionRelated(&(*phase), updateData);
+
+        if (related)
+            Recalculate();
+    }
+
+    if (related)
+        Update();
 }
 
 //////////////////////////////////////////////////////////////////
@@ -81,32 +111,57 @@ void PhaseMgr::NotifyConditionChanged(PhaseUpdateData const& updateData)
 
 void PhaseMgr::Recalculate()
 {
-    if (phaseData.HasActiveDefinitions())
+    _DefinitionChecksZoneId = player->GetZoneId();
+    _DefinitionChecks.clear();
+
+    PhaseDefinitionStore::const_iterator itr = _PhaseDefinitionStore->find(player->GetZoneId());
+    if (itr != _PhaseDefinitionStore->end())
+        ApplyDefinitions(itr->second);
+    else if (phaseData.HasActiveDefinitions())
     {
         phaseData.ResetDefinitions();
         _UpdateFlags |= (PHASE_UPDATE_FLAG_CLIENTSIDE_CHANGED | PHASE_UPDATE_FLAG_SERVERSIDE_CHANGED);
     }
+}
 
-    PhaseDefinitionStore::const_iterator itr = _PhaseDefinitionStore->find(player->GetZoneId());
-    if (itr != _PhaseDefinitionStore->end())
+// Rebuilds the active definitions, only definitions without a cached check are checked
+void PhaseMgr::ApplyDefinitions(PhaseDefinitionContainer const& definitions)
+{
+    std::list<PhaseDefinition const*> oldDefinitions = phaseData.GetActiveDefinitions();
+    phaseData.ResetDefinitions();
+
+    _DefinitionChecks.resize(definitions.size(), DEFINITION_CHECK_NONE);
+
+    uint8 updateFlags = 0;
+    uint32 index = 0;
+    for (PhaseDefinitionContainer::const_iterator phase = definitions.begin(); phase != definitions.end(); ++phase, ++index)
     {
-        for (PhaseDefinitionContainer::const_iterator phase = itr->second.begin(); phase != itr->second.end(); ++phase)
+        if (_DefinitionChecks[index] == DEFINITION_CHECK_NONE)
+            _DefinitionChecks[index] = CheckDefinition(&(*phase)) ? DEFINITION_CHECK_MET : DEFINITION_CHECK_FAILED;
+
+        if (_DefinitionChecks[index] == DEFINITION_CHECK_MET)
         {
-            if (CheckDefinition(&(*phase)))
-            {
-                phaseData.AddPhaseDefinition(&(*phase));
+            phaseData.AddPhaseDefinition(&(*phase));
 
-                if (phase->phasemask)
-                    _UpdateFlags |= PHASE_UPDATE_FLAG_SERVERSIDE_CHANGED;
+            if (phase->phasemask)
+                updateFlags |= PHASE_UPDATE_FLAG_SERVERSIDE_CHANGED;
 
-                if (phase->phaseId || phase->terrainswapmap || phase->worldmaparea)
-                    _UpdateFlags |= PHASE_UPDATE_FLAG_CLIENTSIDE_CHANGED;
+            if (phase->phaseId || phase->terrainswapmap || phase->worldmaparea)
+                updateFlags |= PHASE_UPDATE_FLAG_CLIENTSIDE_CHANGED;
 
-                if (phase->IsLastDefinition())
-                    break;
-            }
+            if (phase->IsLastDefinition())
+                break;
         }
     }
+
+    // same definitions give the same phases, nothing to send then
+    if (phaseData.GetActiveDefinitions() == oldDefinitions)
+        return;
+
+    if (!oldDefinitions.empty())
+        updateFlags |= (PHASE_UPDATE_FLAG_CLIENTSIDE_CHANGED | PHASE_UPDATE_FLAG_SERVERSIDE_CHANGED);
+
+    _UpdateFlags |= updateFlags;
 }
 
 inline bool PhaseMgr::CheckDefinition(PhaseDefinition const* phaseDefinition)
@@ -114,20 +169,37 @@ inline bool PhaseMgr::CheckDefinition(PhaseDefinition const* phaseDefinition)
     return sConditionMgr->IsObjectMeetToConditions(player, sConditionMgr->GetConditionsForPhaseDefinition(phaseDefinition->zoneId, phaseDefinition->entry));
 }
 
-bool PhaseMgr::NeedsPhaseUpdateWithData(PhaseUpdateData const updateData) const
+bool PhaseMgr::IsDefinitionRelated(PhaseDefinition const* phaseDefinition, PhaseUpdateData const& updateData) const
 {
-    PhaseDefinitionStore::const_iterator itr = _PhaseDefinitionStore->find(player->GetZoneId());
-    if (itr != _PhaseDefinitionStore->end())
+    ConditionList const& conditionList = sConditionMgr->GetConditionsForPhaseDefinition(phaseDefinition->zoneId, phaseDefinition->entry);
+    for (ConditionList::const_iterator condition = conditionList.begin(); condition != conditionList.end(); ++condition)
+        if (updateData.IsConditionRelated(*condition))
+            return true;
+
+    return false;
+}
+
+// Only quest, level and instance data changes are notified, a cached check of any other condition could get stale
+bool PhaseMgr::IsDefinitionCacheable(PhaseDefinition const* phaseDefinition) const
+{
+    ConditionList const& conditionList = sConditionMgr->GetConditionsForPhaseDefinition(phaseDefinition->zoneId, phaseDefinition->entry);
+    for (ConditionList::const_iterator condition = conditionList.begin(); condition != conditionList.end(); ++condition)
     {
-        for (PhaseDefinitionContainer::const_iterator phase = itr->second.begin(); phase != itr->second.end(); ++phase)
+        switch ((*condition)->ConditionType)
         {
-            ConditionList conditionList = sConditionMgr->GetConditionsForPhaseDefinition(phase->zoneId, phase->entry);
-            for (ConditionList::const_iterator condition = conditionList.begin(); condition != conditionList.end(); ++condition)
-                if (updateData.IsConditionRelated(*condition))
-                    return true;
+            case CONDITION_QUESTREWARDED:
+            case CONDITION_QUESTTAKEN:
+            case CONDITION_QUEST_COMPLETE:
+            case CONDITION_QUEST_NONE:
+            case CONDITION_LEVEL:
+            case CONDITION_INSTANCE_DATA:
+                break;
+            default:
+                return false;
         }
     }
-    return false;
+
+    return true;
 }
 
 //////////////////////////////////////////////////////////////////
@@ -109,6 +109,7 @@ struct PhaseData
     void SendPhaseshiftToPlayer();
 
     void GetActivePhases(std::set<uint32>& phases) const;
+    std::list<PhaseDefinition const*> const& GetActiveDefinitions() const { return activePhaseDefinitions; }
 
 private:
     Player* player;
@@ -118,6 +119,8 @@ private:
 
 struct PhaseUpdateData
 {
+    PhaseUpdateData() : _conditionTypeFlags(0), _questId(0) { }
+
     void AddConditionType(ConditionTypes const conditionType) { _conditionTypeFlags |= (1 << conditionType); }
     void AddQuestUpdate(uint32 const questId);
 
@@ -162,11 +165,21 @@ public:
     void GetActivePhases(std::set<uint32>& phases) const;
 
 private:
+    // cached CheckDefinition results of the zone definitions
+    enum DefinitionCheck
+    {
+        DEFINITION_CHECK_NONE,
+        DEFINITION_CHECK_MET,
+        DEFINITION_CHECK_FAILED
+    };
+
     void Recalculate();
+    void ApplyDefinitions(PhaseDefinitionContainer const& definitions);
 
     inline bool CheckDefinition(PhaseDefinition const* phaseDefinition);
 
-    bool NeedsPhaseUpdateWithData(PhaseUpdateData const updateData) const;
+    bool IsDefinitionRelated(PhaseDefinition const* phaseDefinition, PhaseUpdateData const& updateData) const;
+    bool IsDefinitionCacheable(PhaseDefinition const* phaseDefinition) const;
 
     inline bool IsUpdateInProgress() const { return (_UpdateFlags & PHASE_UPDATE_FLAG_ZONE_UPDATE) || (_UpdateFlags & PHASE_UPDATE_FLAG_AREA_UPDATE); }
 
@@ -176,6 +189,9 @@ private:
     Player* player;
     PhaseData phaseData;
     uint8 _UpdateFlags;
+
+    uint32 _DefinitionChecksZoneId;
+    std::vector<uint8> _DefinitionChecks;                   // DefinitionCheck, in PhaseDefinitionContainer order
 };
 
 #endif
\ No newline at end of file
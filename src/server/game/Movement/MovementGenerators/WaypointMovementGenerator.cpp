@@ -146,7 +146,7 @@ bool WaypointMovementGenerator<Creature>::StartMove(Creature* owner)
 
     // Call for creature group update
     if (owner->GetFormation() && owner->GetFormation()->getLeader() == owner)
-        owner->GetFormation()->LeaderMoveTo(node->x, node->y, node->z);
+        owner->GetFormation()->LeaderMoveTo(node->x, node->y, node->z, node);
 
     return true;
 }
@@ -39,6 +39,7 @@
 #include "Battlefield.h"
 #include "BattlefieldMgr.h"
 #include "WeatherMgr.h"
+#include "ObjectPool.h"
 
 class Aura;
 //
@@ -496,6 +497,18 @@ pAuraEffectHandler AuraEffectHandler[TOTAL_AURAS]=
     &AuraEffect::HandleNULL,                                      //437 SPELL_AURA_437
 };
 
+static ObjectPool sAuraEffectPool("AuraEffect", sizeof(AuraEffect), 2048);
+
+void* AuraEffect::operator new(size_t size)
+{
+    return sAuraEffectPool.Allocate(size);
+}
+
+void AuraEffect::operator delete(void* ptr, size_t size)
+{
+    sAuraEffectPool.Deallocate(ptr, size);
+}
+
 AuraEffect::AuraEffect(AuraPtr base, uint8 effIndex, int32 *baseAmount, Unit* caster):
 m_base(base), m_spellInfo(base->GetSpellInfo()),
 m_baseAmount(baseAmount ? *baseAmount : m_spellInfo->Effects[effIndex].BasePoints),
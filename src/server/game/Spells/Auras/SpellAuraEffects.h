@@ -37,6 +37,11 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
         explicit AuraEffect(AuraPtr base, uint8 effIndex, int32 *baseAmount, Unit* caster);
     public:
         ~AuraEffect();
+
+        // memory is taken from ObjectPool, every aura creates one effect object per effect
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         Unit* GetCaster() const { return GetBase() ? GetBase()->GetCaster() : NULL; }
         uint64 GetCasterGUID() const { return GetBase()->GetCasterGUID(); }
 
@@ -35,6 +35,7 @@
 #include "CellImpl.h"
 #include "ScriptMgr.h"
 #include "SpellScript.h"
+#include "ObjectPool.h"
 #include "Vehicle.h"
 
 AuraApplication::AuraApplication(Unit* target, Unit* caster, AuraPtr aura, uint32 effMask):
@@ -2700,7 +2701,7 @@ bool Aura::IsProcTriggeredOnEvent(AuraApplication* aurApp, ProcEventInfo& eventI
         return false;
 
     // do checks using conditions table
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, GetId());
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, GetId());
     ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
     if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
         return false;
@@ -3321,6 +3322,18 @@ void Aura::CallScriptAfterEffectProcHandlers(constAuraEffectPtr aurEff, AuraAppl
         sLog->OutSpecialLog("AuraScript [%u] take more than 15 ms to execute (%u ms)", GetId(), scriptExecuteTime);
 }
 
+static ObjectPool sUnitAuraPool("UnitAura", sizeof(UnitAura), 1024);
+
+void* UnitAura::operator new(size_t size)
+{
+    return sUnitAuraPool.Allocate(size);
+}
+
+void UnitAura::operator delete(void* ptr, size_t size)
+{
+    sUnitAuraPool.Deallocate(ptr, size);
+}
+
 UnitAura::UnitAura(SpellInfo const* spellproto, uint32 effMask, WorldObject* owner, Unit* caster, SpellPowerEntry const* spellPowerData, int32 *baseAmount, Item* castItem, uint64 casterGUID)
     : Aura(spellproto, owner, caster, spellPowerData, castItem, casterGUID)
 {
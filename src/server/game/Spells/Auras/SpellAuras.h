@@ -271,6 +271,10 @@ class UnitAura : public Aura
     protected:
         explicit UnitAura(SpellInfo const* spellproto, uint32 effMask, WorldObject* owner, Unit* caster, SpellPowerEntry const* spellPowerData, int32 *baseAmount, Item* castItem, uint64 casterGUID);
     public:
+        // memory is taken from ObjectPool, unit auras are created and removed at high rate
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         void _ApplyForTarget(Unit* target, Unit* caster, AuraApplication * aurApp);
         void _UnapplyForTarget(Unit* target, Unit* caster, AuraApplication * aurApp);
 
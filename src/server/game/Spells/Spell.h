@@ -440,6 +440,10 @@ class Spell
         Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, uint64 originalCasterGUID = 0, bool skipCheck = false);
         ~Spell();
 
+        // Spell objects are created for every cast, memory is taken from ObjectPool
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         void InitExplicitTargets(SpellCastTargets const& targets);
         void SelectExplicitTargets();
 
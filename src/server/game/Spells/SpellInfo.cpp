@@ -1137,6 +1137,8 @@ SpellInfo::SpellInfo(SpellEntry const* spellEntry, uint32 difficulty)
     ChainEntry = NULL;
 
     ResearchProject =  spellEntry->ResearchProject;
+
+    _LoadHotData();
 }
 
 SpellInfo::~SpellInfo()
@@ -1146,34 +1148,22 @@ SpellInfo::~SpellInfo()
 
 bool SpellInfo::HasEffect(SpellEffects effect) const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (Effects[i].IsEffect(effect))
-            return true;
-    return false;
+    return uint32(effect) < TOTAL_SPELL_EFFECTS && _effectTypes.test(effect);
 }
 
 bool SpellInfo::HasAura(AuraType aura) const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (Effects[i].IsAura(aura))
-            return true;
-    return false;
+    return uint32(aura) < TOTAL_AURAS && _auraTypes.test(aura);
 }
 
 bool SpellInfo::HasAreaAuraEffect() const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (Effects[i].IsAreaAuraEffect())
-            return true;
-    return false;
+    return _areaAuraEffectMask != 0;
 }
 
 bool SpellInfo::HasPersistenAura() const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (Effects[i].IsPersistentAreaAura())
-            return true;
-    return false;
+    return _persistentAuraEffectMask != 0;
 }
 
 bool SpellInfo::IsExplicitDiscovery() const
@@ -1277,19 +1267,13 @@ bool SpellInfo::IsAbilityOfSkillType(uint32 skillType) const
 
 bool SpellInfo::IsAffectingArea() const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (Effects[i].IsEffect() && (Effects[i].IsTargetingArea() || Effects[i].IsEffect(SPELL_EFFECT_PERSISTENT_AREA_AURA) || Effects[i].IsAreaAuraEffect()))
-            return true;
-    return false;
+    return _areaTargetEffectMask || _areaAuraEffectMask || HasEffect(SPELL_EFFECT_PERSISTENT_AREA_AURA);
 }
 
 // checks if spell targets are selected from area, doesn't include spell effects in check (like area wide auras for example)
 bool SpellInfo::IsTargetingArea() const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (Effects[i].IsEffect() && Effects[i].IsTargetingArea())
-            return true;
-    return false;
+    return _areaTargetEffectMask != 0;
 }
 
 bool SpellInfo::NeedsExplicitUnitTarget() const
@@ -2553,22 +2537,14 @@ SpellSpecificType SpellInfo::GetSpellSpecific() const
 
 float SpellInfo::GetMinRange(bool positive) const
 {
-    if (!RangeEntry)
-        return 0.0f;
-    if (positive)
-        return RangeEntry->minRangeFriend;
-    return RangeEntry->minRangeHostile;
+    return _minRange[positive];
 }
 
 float SpellInfo::GetMaxRange(bool positive, Unit* caster, Spell* spell) const
 {
     if (!RangeEntry)
         return 0.0f;
-    float range;
-    if (positive)
-        range = RangeEntry->maxRangeFriend;
-    else
-        range = RangeEntry->maxRangeHostile;
+    float range = _maxRange[positive];
     if (caster)
         if (Player* modOwner = caster->GetSpellModOwner())
             modOwner->ApplySpellMod(Id, SPELLMOD_RANGE, range, spell);
@@ -3287,6 +3263,40 @@ void SpellInfo::SetDurationIndex(uint32 index)
     DurationEntry = durationIndex;
 }
 
+// Must be called again whenever effects or range are changed after construction,
+// SetEffect and SetRangeIndex do it on their own
+void SpellInfo::_LoadHotData()
+{
+    _effectTypes.reset();
+    _auraTypes.reset();
+    _areaAuraEffectMask = 0;
+    _persistentAuraEffectMask = 0;
+    _areaTargetEffectMask = 0;
+    _periodicEffectMask = 0;
+
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        SpellEffectInfo const& effect = Effects[i];
+        if (effect.Effect < TOTAL_SPELL_EFFECTS)
+            _effectTypes.set(effect.Effect);
+        if (effect.IsAura() && effect.ApplyAuraName < TOTAL_AURAS)
+            _auraTypes.set(effect.ApplyAuraName);
+        if (effect.IsAreaAuraEffect())
+            _areaAuraEffectMask |= 1 << i;
+        if (effect.IsPersistentAreaAura())
+            _persistentAuraEffectMask |= 1 << i;
+        if (effect.IsEffect() && effect.IsTargetingArea())
+            _areaTargetEffectMask |= 1 << i;
+        if (effect.IsPeriodicEffect())
+            _periodicEffectMask |= 1 << i;
+    }
+
+    _minRange[0] = RangeEntry ? RangeEntry->minRangeHostile : 0.0f;
+    _minRange[1] = RangeEntry ? RangeEntry->minRangeFriend : 0.0f;
+    _maxRange[0] = RangeEntry ? RangeEntry->maxRangeHostile : 0.0f;
+    _maxRange[1] = RangeEntry ? RangeEntry->maxRangeFriend : 0.0f;
+}
+
 void SpellInfo::SetRangeIndex(uint32 index)
 {
     SpellRangeEntry const* rangeIndex = sSpellRangeStore.LookupEntry(index);
@@ -3294,6 +3304,16 @@ void SpellInfo::SetRangeIndex(uint32 index)
         return;
 
     RangeEntry = rangeIndex;
+    _LoadHotData();
+}
+
+void SpellInfo::SetEffect(uint8 effIndex, uint32 effect)
+{
+    if (effIndex >= MAX_SPELL_EFFECTS)
+        return;
+
+    Effects[effIndex].Effect = effect;
+    _LoadHotData();
 }
 
 void SpellInfo::SetCastTimeIndex(uint32 index)
@@ -3997,12 +4017,7 @@ bool SpellInfo::IsPeriodicHeal() const
 
 bool SpellInfo::IsPeriodic() const
 {
-    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-    {
-       if (Effects[i].IsPeriodicEffect())
-           return true;
-    }
-    return false;
+    return _periodicEffectMask != 0;
 }
 
 bool SpellEffectInfo::IsPeriodicEffect() const
@@ -22,6 +22,9 @@
 #include "Util.h"
 #include "DBCStructure.h"
 #include "Object.h"
+#include "SpellAuraDefines.h"
+
+#include <bitset>
 
 class Unit;
 class Player;
@@ -595,14 +598,29 @@ public:
     static bool _IsPositiveTarget(uint32 targetA, uint32 targetB);
     bool _IsCrowdControl(uint8 effMask, bool nodamage) const;
     bool _IsNeedDelay() const;
+    void _LoadHotData();
 
-    // correction helpers
+    // correction helpers, use these instead of writing Effects[].Effect or RangeEntry
+    // directly once the spell store is loaded, they keep the effect summary in sync
     void SetDurationIndex(uint32 index);
     void SetRangeIndex(uint32 index);
+    void SetEffect(uint8 effIndex, uint32 effect);
     void SetCastTimeIndex(uint32 index);
 
     // unloading helpers
     void _UnloadImplicitTargetConditionLists();
+
+private:
+    // Summary of the effects and the range entry built by _LoadHotData(), used by
+    // the checks done on every cast and proc instead of walking all MAX_SPELL_EFFECTS effects
+    std::bitset<TOTAL_SPELL_EFFECTS> _effectTypes;
+    std::bitset<TOTAL_AURAS> _auraTypes;
+    uint32 _areaAuraEffectMask;
+    uint32 _persistentAuraEffectMask;
+    uint32 _areaTargetEffectMask;
+    uint32 _periodicEffectMask;
+    float _minRange[2];                                     // [positive]
+    float _maxRange[2];                                     // [positive]
 };
 
 #endif // _SPELLINFO_H
@@ -615,7 +615,7 @@ bool IsDiminishingReturnsGroupDurationLimited(DiminishingGroup group)
     }
 }
 
-SpellMgr::SpellMgr()
+SpellMgr::SpellMgr() : mProcDataGeneration(0), mProcStatsEnabled(false)
 {
 }
 
@@ -1266,6 +1266,28 @@ bool SpellMgr::CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcE
     return true;
 }
 
+void SpellMgr::AddProcStat(uint32 spellId, bool triggered)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, mProcStatsLock);
+    SpellProcStat& stat = mProcStats[spellId];
+    if (triggered)
+        ++stat.triggers;
+    else
+        ++stat.checks;
+}
+
+void SpellMgr::ResetProcStats()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, mProcStatsLock);
+    mProcStats.clear();
+}
+
+void SpellMgr::GetProcStats(SpellProcStatMap& stats)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, mProcStatsLock);
+    stats = mProcStats;
+}
+
 SpellBonusEntry const* SpellMgr::GetSpellBonusData(uint32 spellId) const
 {
     // Lookup data
@@ -2103,6 +2125,7 @@ void SpellMgr::LoadSpellProcEvents()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcEventMap.clear();                             // need for reload case
+    ++mProcDataGeneration;
 
     //                                                0      1           2                3                 4                 5                 6                   7           8        9         10         11
     QueryResult result = WorldDatabase.Query("SELECT entry, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, spellFamilyMask3, procFlags, procEx, ppmRate, CustomChance, Cooldown FROM spell_proc_event");
@@ -2169,6 +2192,7 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear();                             // need for reload case
+    ++mProcDataGeneration;
 
     //                                                 0        1           2                3                 4                 5                 6         7              8               9        10              11             12      13        14
     QueryResult result = WorldDatabase.Query("SELECT spellId, schoolMask, spellFamilyName, spellFamilyMask0, spellFamilyMask1, spellFamilyMask2, typeMask, spellTypeMask, spellPhaseMask, hitMask, attributesMask, ratePerMinute, chance, cooldown, charges FROM spell_proc");
@@ -5374,7 +5398,7 @@ void SpellMgr::LoadSpellCustomAttr()
                     spellInfo->Effects[0].TargetB = 0;
                     break;
                 case 118685:// Battering Headbutt
-                    spellInfo->RangeEntry = sSpellRangeStore.LookupEntry(5);
+                    spellInfo->SetRangeIndex(5);
                     break;
                 case 60670: // Malygos Enrage
                     spellInfo->Effects[1].TriggerSpell = 0;
@@ -9011,6 +9035,7 @@ void SpellMgr::LoadSpellCustomAttr()
 
             // This must be re-done if targets changed since the spellinfo load
             spellInfo->ExplicitTargetMask = spellInfo->_GetExplicitTargetMask();
+            spellInfo->_LoadHotData();
 
             switch (spellInfo->Id)
             {
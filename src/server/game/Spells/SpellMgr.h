@@ -301,6 +301,17 @@ struct SpellProcEntry
 
 typedef UNORDERED_MAP<uint32, SpellProcEntry> SpellProcMap;
 
+// per aura counters of Unit::ProcDamageAndSpellFor, collected only while enabled by .debug procstats
+struct SpellProcStat
+{
+    SpellProcStat() : checks(0), triggers(0) {}
+
+    uint64      checks;                                     // proc event passed the proc flags filter and was checked in details
+    uint64      triggers;                                   // aura was added to the triggered list
+};
+
+typedef UNORDERED_MAP<uint32, SpellProcStat> SpellProcStatMap;
+
 struct SpellEnchantProcEntry
 {
     uint32      customChance;
@@ -669,6 +680,16 @@ class SpellMgr
         SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
         bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo);
 
+        // increased on every proc tables (re)load, units use it to refresh their cached proc flags
+        uint32 GetProcDataGeneration() const { return mProcDataGeneration; }
+
+        // Proc statistics
+        bool IsProcStatsEnabled() const { return mProcStatsEnabled; }
+        void SetProcStatsEnabled(bool enabled) { mProcStatsEnabled = enabled; }
+        void AddProcStat(uint32 spellId, bool triggered);
+        void ResetProcStats();
+        void GetProcStats(SpellProcStatMap& stats);
+
         // Spell bonus data table
         SpellBonusEntry const* GetSpellBonusData(uint32 spellId) const;
 
@@ -777,6 +798,10 @@ class SpellMgr
         SpellPowerVector           mSpellPowerInfo;
         std::list<uint32>          mForbiddenSpells;
         ItemUpgradeDatas           mItemUpgradeDatas;
+        uint32                     mProcDataGeneration;
+        bool                       mProcStatsEnabled;
+        SpellProcStatMap           mProcStats;
+        ACE_Thread_Mutex           mProcStatsLock;
 };
 
 #define sSpellMgr ACE_Singleton<SpellMgr, ACE_Null_Mutex>::instance()
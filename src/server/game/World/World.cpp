@@ -55,6 +55,7 @@
 #include "TemporarySummon.h"
 #include "WaypointMovementGenerator.h"
 #include "VMapFactory.h"
+#include "VMapManager2.h"
 #include "GameEventMgr.h"
 #include "PoolMgr.h"
 #include "GridNotifiersImpl.h"
@@ -666,6 +667,12 @@ void World::LoadConfigSettings(bool reload)
 
     m_int_configs[CONFIG_SOCKET_TIMEOUTTIME] = ConfigMgr::GetIntDefault("SocketTimeOutTime", 900000);
     m_int_configs[CONFIG_SESSION_ADD_DELAY] = ConfigMgr::GetIntDefault("SessionAddDelay", 10000);
+    m_int_configs[CONFIG_LOGIN_QUERY_CONNECTIONS] = ConfigMgr::GetIntDefault("CharacterDatabase.LoginQueryConnections", 4);
+    if (m_int_configs[CONFIG_LOGIN_QUERY_CONNECTIONS] < 1 || m_int_configs[CONFIG_LOGIN_QUERY_CONNECTIONS] > 255)
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "CharacterDatabase.LoginQueryConnections (%u) must be in range 1..255. Set to 1.", m_int_configs[CONFIG_LOGIN_QUERY_CONNECTIONS]);
+        m_int_configs[CONFIG_LOGIN_QUERY_CONNECTIONS] = 1;
+    }
 
     m_float_configs[CONFIG_GROUP_XP_DISTANCE] = ConfigMgr::GetFloatDefault("MaxGroupXPDistance", 74.0f);
     m_float_configs[CONFIG_MAX_RECRUIT_A_FRIEND_DISTANCE] = ConfigMgr::GetFloatDefault("MaxRecruitAFriendBonusDistance", 100.0f);
@@ -906,6 +913,7 @@ void World::LoadConfigSettings(bool reload)
 
     m_bool_configs[CONFIG_CAST_UNSTUCK] = ConfigMgr::GetBoolDefault("CastUnstuck", true);
     m_int_configs[CONFIG_INSTANCE_RESET_TIME_HOUR]  = ConfigMgr::GetIntDefault("Instance.ResetTimeHour", 4);
+    m_int_configs[CONFIG_INSTANCE_RESET_BATCH_SIZE] = ConfigMgr::GetIntDefault("Instance.ResetBatchSize", 100);
     m_int_configs[CONFIG_INSTANCE_UNLOAD_DELAY] = ConfigMgr::GetIntDefault("Instance.UnloadDelay", 30 * MINUTE * IN_MILLISECONDS);
 
     m_int_configs[CONFIG_MAX_PRIMARY_TRADE_SKILL] = ConfigMgr::GetIntDefault("MaxPrimaryTradeSkill", 2);
@@ -944,6 +952,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_GROUP_VISIBILITY] = ConfigMgr::GetIntDefault("Visibility.GroupMode", 1);
 
     m_int_configs[CONFIG_MAIL_DELIVERY_DELAY] = ConfigMgr::GetIntDefault("MailDeliveryDelay", HOUR);
+    m_int_configs[CONFIG_MAIL_EXPIRY_BATCH_SIZE] = ConfigMgr::GetIntDefault("MailExpiryBatchSize", 1000);
 
     m_int_configs[CONFIG_UPTIME_UPDATE] = ConfigMgr::GetIntDefault("UpdateUptimeInterval", 10);
     if (int32(m_int_configs[CONFIG_UPTIME_UPDATE]) <= 0)
@@ -1022,6 +1031,7 @@ void World::LoadConfigSettings(bool reload)
     m_float_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS] = ConfigMgr::GetFloatDefault("CreatureFamilyAssistanceRadius", 10.0f);
     m_int_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY]  = ConfigMgr::GetIntDefault("CreatureFamilyAssistanceDelay", 1500);
     m_int_configs[CONFIG_CREATURE_FAMILY_FLEE_DELAY]        = ConfigMgr::GetIntDefault("CreatureFamilyFleeDelay", 7000);
+    m_int_configs[CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL]  = ConfigMgr::GetIntDefault("CreatureDormantUpdateInterval", 2000);
 
     m_int_configs[CONFIG_WORLD_BOSS_LEVEL_DIFF] = ConfigMgr::GetIntDefault("WorldBossLevelDiff", 3);
 
@@ -1212,6 +1222,7 @@ void World::LoadConfigSettings(bool reload)
 
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableLineOfSightCalc(enableLOS);
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableHeightCalc(enableHeight);
+    ((VMAP::VMapManager2*)VMAP::VMapFactory::createOrGetVMapManager())->setUnusedModelCacheSize(uint64(ConfigMgr::GetIntDefault("vmap.unusedModelCacheSize", 64)) * 1024 * 1024);
     //VMAP::VMapFactory::preventSpellsFromBeingTestedForLoS(ignoreSpellIds.c_str());
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap support included. LineOfSight:%i, getHeight:%i, indoorCheck:%i PetLOS:%i", enableLOS, enableHeight, enableIndoor, enablePetLOS);
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap data directory is: %svmaps", m_dataPath.c_str());
@@ -1219,6 +1230,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_MAX_WHO] = ConfigMgr::GetIntDefault("MaxWhoListReturns", 49);
     m_bool_configs[CONFIG_LIMIT_WHO_ONLINE] = ConfigMgr::GetBoolDefault("LimitWhoOnline", true);
     m_bool_configs[CONFIG_PET_LOS] = ConfigMgr::GetBoolDefault("vmap.petLOS", true);
+    m_bool_configs[CONFIG_VMAP_LOS_CACHE] = ConfigMgr::GetBoolDefault("vmap.LOSCache", true);
     m_bool_configs[CONFIG_START_ALL_SPELLS] = ConfigMgr::GetBoolDefault("PlayerStart.AllSpells", false);
     if (m_bool_configs[CONFIG_START_ALL_SPELLS])
         sLog->outWarn(LOG_FILTER_SERVER_LOADING, "PlayerStart.AllSpells enabled - may not function as intended!");
@@ -1238,6 +1250,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = ConfigMgr::GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = ConfigMgr::GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = ConfigMgr::GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_AUCTION_SEARCH_THREADS] = ConfigMgr::GetIntDefault("AuctionHouse.SearchThreads", 1);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = ConfigMgr::GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1299,6 +1312,7 @@ void World::LoadConfigSettings(bool reload)
     // Guild save interval
     m_bool_configs[CONFIG_GUILD_LEVELING_ENABLED] = ConfigMgr::GetBoolDefault("Guild.LevelingEnabled", true);
     m_int_configs[CONFIG_GUILD_SAVE_INTERVAL] = ConfigMgr::GetIntDefault("Guild.SaveInterval", 15);
+    m_int_configs[CONFIG_GUILD_CONTENT_UNLOAD_DELAY] = ConfigMgr::GetIntDefault("Guild.ContentUnloadDelay", 30);
     m_int_configs[CONFIG_GUILD_MAX_LEVEL] = ConfigMgr::GetIntDefault("Guild.MaxLevel", 25);
     m_int_configs[CONFIG_GUILD_UNDELETABLE_LEVEL] = ConfigMgr::GetIntDefault("Guild.UndeletableLevel", 4);
 
@@ -1838,6 +1852,7 @@ void World::SetInitialWorldSettings()
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Auctions...");
     sAuctionMgr->LoadAuctions();
+    sAuctionMgr->ActivateSearchThreads(m_int_configs[CONFIG_AUCTION_SEARCH_THREADS]);
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild XP for level...");
@@ -2034,6 +2049,7 @@ void World::SetInitialWorldSettings()
     mail_timer = ((((localTm.tm_hour + 20) % 24)* HOUR * IN_MILLISECONDS) / m_timers[WUPDATE_AUCTIONS].GetInterval());
                                                             //1440
     mail_timer_expires = ((DAY * IN_MILLISECONDS) / (m_timers[WUPDATE_AUCTIONS].GetInterval()));
+    mail_expiry_pending = false;
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Mail timer set to: " UI64FMTD ", mail return is called every " UI64FMTD " minutes", uint64(mail_timer), uint64(mail_timer_expires));
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
@@ -2356,19 +2372,29 @@ void World::Update(uint32 diff)
         if (++mail_timer > mail_timer_expires)
         {
             mail_timer = 0;
-            sObjectMgr->ReturnOrDeleteOldMails(true);
+            mail_expiry_pending = true;
         }
 
         ///- Handle expired auctions
         sAuctionMgr->Update();
     }
 
+    ///- Return or delete expired mails, one bounded batch per update until none are left
+    if (mail_expiry_pending)
+        mail_expiry_pending = sObjectMgr->ReturnOrDeleteOldMails(true);
+
     uint32 diffTime = getMSTime();
 
+    ///- Send auction house searches finished by the search threads
+    sAuctionMgr->SendSearchResults();
+
     /// <li> Handle session updates when the timer has passed
     RecordTimeDiff(NULL);
     UpdateSessions(diff);
 
+    ///- Send guild rosters changed by this update's sessions
+    sGuildMgr->SendRosterBroadcasts();
+
     SetRecordDiff(RECORD_DIFF_SESSION, getMSTime() - diffTime);
     diffTime = getMSTime();
 
@@ -2496,6 +2522,7 @@ void World::Update(uint32 diff)
     {
         m_timers[WUPDATE_GUILDSAVE].Reset();
         sGuildMgr->SaveGuilds();
+        sGuildMgr->UnloadIdleGuildContent();
     }
 
     // Update Blackmarket
@@ -32,6 +32,13 @@ EndScriptData */
 #include "GridNotifiersImpl.h"
 #include "GossipDef.h"
 #include "MapManager.h"
+#include "SpellMgr.h"
+#include "SpellInfo.h"
+#include "ObjectPool.h"
+#include "VMapFactory.h"
+#include "VMapManager2.h"
+#include "SmartScriptMgr.h"
+#include "AchievementMgr.h"
 
 #include <fstream>
 
@@ -90,6 +97,7 @@ class debug_commandscript : public CommandScript
                 { "itemexpire",     SEC_ADMINISTRATOR,  false, &HandleDebugItemExpireCommand,      "", NULL },
                 { "areatriggers",   SEC_ADMINISTRATOR,  false, &HandleDebugAreaTriggersCommand,    "", NULL },
                 { "los",            SEC_MODERATOR,      false, &HandleDebugLoSCommand,             "", NULL },
+                { "dormant",        SEC_MODERATOR,      false, &HandleDebugDormantCommand,         "", NULL },
                 { "moveflags",      SEC_ADMINISTRATOR,  false, &HandleDebugMoveflagsCommand,       "", NULL },
                 { "phase",          SEC_MODERATOR,      false, &HandleDebugPhaseCommand,           "", NULL },
                 { "tradestatus",    SEC_ADMINISTRATOR,  false, &HandleSendTradeStatus,             "", NULL },
@@ -100,6 +108,11 @@ class debug_commandscript : public CommandScript
                 { "packet",         SEC_ADMINISTRATOR,  false, &HandleDebugPacketCommand,          "", NULL },
                 { "guildevent",     SEC_ADMINISTRATOR,  false, &HandleDebugGuildEventCommand,      "", NULL },
                 { "log",            SEC_ADMINISTRATOR,  false, &HandleDebugLogCommand,             "", NULL },
+                { "procstats",      SEC_ADMINISTRATOR,  true,  &HandleDebugProcStatsCommand,       "", NULL },
+                { "objectpools",    SEC_ADMINISTRATOR,  true,  &HandleDebugObjectPoolsCommand,     "", NULL },
+                { "vmap",           SEC_ADMINISTRATOR,  true,  &HandleDebugVMapCommand,            "", NULL },
+                { "smartstats",     SEC_ADMINISTRATOR,  true,  &HandleDebugSmartStatsCommand,      "", NULL },
+                { "achievementstats", SEC_ADMINISTRATOR, true,  &HandleDebugAchievementStatsCommand, "", NULL },
                 { NULL,             SEC_PLAYER,         false, NULL,                               "", NULL }
             };
             static ChatCommand commandTable[] =
@@ -1138,6 +1151,179 @@ class debug_commandscript : public CommandScript
             return true;
         }
 
+        static bool SortProcStatByChecks(std::pair<uint32, SpellProcStat> const& a, std::pair<uint32, SpellProcStat> const& b)
+        {
+            return a.second.checks > b.second.checks;
+        }
+
+        // .debug procstats [on|off|reset] - without argument shows most checked proc auras
+        static bool HandleDebugProcStatsCommand(ChatHandler* handler, char const* args)
+        {
+            std::string argstr = (char*)args;
+
+            if (argstr == "on")
+            {
+                sSpellMgr->SetProcStatsEnabled(true);
+                handler->SendSysMessage("Proc statistics collecting is ON.");
+                return true;
+            }
+            else if (argstr == "off")
+            {
+                sSpellMgr->SetProcStatsEnabled(false);
+                handler->SendSysMessage("Proc statistics collecting is OFF.");
+                return true;
+            }
+            else if (argstr == "reset")
+            {
+                sSpellMgr->ResetProcStats();
+                handler->SendSysMessage("Proc statistics cleared.");
+                return true;
+            }
+            else if (!argstr.empty())
+                return false;
+
+            SpellProcStatMap stats;
+            sSpellMgr->GetProcStats(stats);
+
+            std::vector<std::pair<uint32, SpellProcStat> > sorted(stats.begin(), stats.end());
+            std::sort(sorted.begin(), sorted.end(), SortProcStatByChecks);
+
+            handler->PSendSysMessage("Proc statistics (%s), %u auras:", sSpellMgr->IsProcStatsEnabled() ? "collecting" : "stopped", uint32(sorted.size()));
+            uint32 count = 0;
+            for (std::vector<std::pair<uint32, SpellProcStat> >::const_iterator itr = sorted.begin(); itr != sorted.end() && count < 20; ++itr, ++count)
+            {
+                SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(itr->first);
+                handler->PSendSysMessage("   %u.   %u %s - checks " UI64FMTD ", triggers " UI64FMTD, count + 1, itr->first,
+                    spellInfo ? spellInfo->SpellName : "<unknown>", itr->second.checks, itr->second.triggers);
+            }
+            return true;
+        }
+
+        static bool HandleDebugObjectPoolsCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            if (!ObjectPool::HasStats())
+            {
+                handler->SendSysMessage("Object pool statistics are only collected by builds with WITH_COREDEBUG.");
+                return true;
+            }
+
+            ObjectPool::PoolList const& pools = ObjectPool::GetPools();
+            for (ObjectPool::PoolList::const_iterator itr = pools.begin(); itr != pools.end(); ++itr)
+            {
+                ObjectPool::Stats stats;
+                (*itr)->GetStats(stats);
+                handler->PSendSysMessage("%s (%u bytes): %li allocations, %li from system allocator, %li in use",
+                    stats.name, uint32(stats.blockSize), stats.allocations, stats.systemAllocations, stats.inUse);
+            }
+            return true;
+        }
+
+        static bool HandleDebugVMapCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            VMAP::VMapStatistics stats;
+            ((VMAP::VMapManager2*)VMAP::VMapFactory::createOrGetVMapManager())->getStatistics(stats);
+
+            handler->PSendSysMessage("VMap tiles: %li loads, %li unloads", stats.tileLoads, stats.tileUnloads);
+            handler->PSendSysMessage("VMap models: %li resident (%li KB), %li unused in cache (%li KB)",
+                stats.residentModels, stats.residentSize / 1024, stats.unusedModels, stats.unusedSize / 1024);
+            handler->PSendSysMessage("VMap model files: %li loaded from disk, %li reused from cache, %li evicted",
+                stats.modelLoads, stats.modelCacheHits, stats.modelEvictions);
+            return true;
+        }
+
+        static bool SortSmartExecStatByCount(std::pair<uint64, uint64> const& a, std::pair<uint64, uint64> const& b)
+        {
+            return a.second > b.second;
+        }
+
+        // .debug smartstats [on|off|reset] - without argument shows the SmartAI scripts executing most actions
+        static bool HandleDebugSmartStatsCommand(ChatHandler* handler, char const* args)
+        {
+            std::string argstr = (char*)args;
+
+            if (argstr == "on")
+            {
+                sSmartScriptMgr->SetExecStatsEnabled(true);
+                handler->SendSysMessage("SmartAI statistics collecting is ON.");
+                return true;
+            }
+            else if (argstr == "off")
+            {
+                sSmartScriptMgr->SetExecStatsEnabled(false);
+                handler->SendSysMessage("SmartAI statistics collecting is OFF.");
+                return true;
+            }
+            else if (argstr == "reset")
+            {
+                sSmartScriptMgr->ResetExecStats();
+                handler->SendSysMessage("SmartAI statistics cleared.");
+                return true;
+            }
+            else if (!argstr.empty())
+                return false;
+
+            SmartScriptExecStatMap stats;
+            sSmartScriptMgr->GetExecStats(stats);
+
+            std::vector<std::pair<uint64, uint64> > sorted(stats.begin(), stats.end());
+            std::sort(sorted.begin(), sorted.end(), SortSmartExecStatByCount);
+
+            handler->PSendSysMessage("SmartAI statistics (%s), %u scripts:", sSmartScriptMgr->IsExecStatsEnabled() ? "collecting" : "stopped", uint32(sorted.size()));
+            uint32 count = 0;
+            for (std::vector<std::pair<uint64, uint64> >::const_iterator itr = sorted.begin(); itr != sorted.end() && count < 20; ++itr, ++count)
+                handler->PSendSysMessage("   %u.   entryorguid %d source_type %u - actions " UI64FMTD, count + 1,
+                    int32(PAIR64_LOPART(itr->first)), PAIR64_HIPART(itr->first), itr->second);
+            return true;
+        }
+
+        static bool SortAchievementUpdateStatBySkipped(std::pair<uint32, AchievementCriteriaUpdateStat> const& a, std::pair<uint32, AchievementCriteriaUpdateStat> const& b)
+        {
+            return a.second.SkippedByAsset + a.second.SkippedCompleted > b.second.SkippedByAsset + b.second.SkippedCompleted;
+        }
+
+        // .debug achievementstats [on|off|reset] - without argument shows the criteria types where updates skip most criteria
+        static bool HandleDebugAchievementStatsCommand(ChatHandler* handler, char const* args)
+        {
+            std::string argstr = (char*)args;
+
+            if (argstr == "on")
+            {
+                sAchievementMgr->SetUpdateStatsEnabled(true);
+                handler->SendSysMessage("Achievement criteria statistics collecting is ON.");
+                return true;
+            }
+            else if (argstr == "off")
+            {
+                sAchievementMgr->SetUpdateStatsEnabled(false);
+                handler->SendSysMessage("Achievement criteria statistics collecting is OFF.");
+                return true;
+            }
+            else if (argstr == "reset")
+            {
+                sAchievementMgr->ResetUpdateStats();
+                handler->SendSysMessage("Achievement criteria statistics cleared.");
+                return true;
+            }
+            else if (!argstr.empty())
+                return false;
+
+            AchievementCriteriaUpdateStat stats[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+            sAchievementMgr->GetUpdateStats(stats);
+
+            std::vector<std::pair<uint32, AchievementCriteriaUpdateStat> > sorted;
+            for (uint32 i = 0; i < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++i)
+                if (stats[i].Calls)
+                    sorted.push_back(std::make_pair(i, stats[i]));
+            std::sort(sorted.begin(), sorted.end(), SortAchievementUpdateStatBySkipped);
+
+            handler->PSendSysMessage("Achievement criteria statistics (%s), %u types updated:", sAchievementMgr->IsUpdateStatsEnabled() ? "collecting" : "stopped", uint32(sorted.size()));
+            uint32 count = 0;
+            for (std::vector<std::pair<uint32, AchievementCriteriaUpdateStat> >::const_iterator itr = sorted.begin(); itr != sorted.end() && count < 20; ++itr, ++count)
+                handler->PSendSysMessage("   %u.   %s (%u) - calls " UI64FMTD ", checked " UI64FMTD ", skipped by asset " UI64FMTD ", skipped completed " UI64FMTD,
+                    count + 1, AchievementGlobalMgr::GetCriteriaTypeString(itr->first), itr->first, itr->second.Calls, itr->second.Checked, itr->second.SkippedByAsset, itr->second.SkippedCompleted);
+            return true;
+        }
+
         static bool HandleDebugHostileRefListCommand(ChatHandler* handler, char const* /*args*/)
         {
             Unit* target = handler->getSelectedUnit();
@@ -1393,6 +1579,24 @@ class debug_commandscript : public CommandScript
         {
             if (Unit* unit = handler->getSelectedUnit())
                 handler->PSendSysMessage("Unit %s (GuidLow: %u) is %sin LoS", unit->GetName(), unit->GetGUIDLow(), handler->GetSession()->GetPlayer()->IsWithinLOSInMap(unit) ? "" : "not ");
+
+            uint64 hits, misses;
+            uint32 size;
+            handler->GetSession()->GetPlayer()->GetMap()->GetLOSCacheStats(hits, misses, size);
+            handler->PSendSysMessage("LoS cache of map %u: " UI64FMTD " hits, " UI64FMTD " misses (%.1f%% hit rate), %u entries",
+                handler->GetSession()->GetPlayer()->GetMapId(), hits, misses, hits + misses ? float(hits) * 100.0f / float(hits + misses) : 0.0f, size);
+            return true;
+        }
+
+        static bool HandleDebugDormantCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            if (Creature* creature = handler->getSelectedCreature())
+                handler->PSendSysMessage("Creature %s (GuidLow: %u) is %s", creature->GetName(), creature->GetGUIDLow(), creature->IsDormant() ? "dormant" : "active");
+
+            uint32 active, dormant;
+            handler->GetSession()->GetPlayer()->GetMap()->GetCreatureUpdateStats(active, dormant);
+            handler->PSendSysMessage("Creatures updated on map %u in the last update: %u active, %u dormant",
+                handler->GetSession()->GetPlayer()->GetMapId(), active, dormant);
             return true;
         }
 
@@ -327,12 +327,22 @@ class DatabaseWorkerPool
         //! return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder)
+        //! With parts > 1 the queries are split over up to that many async connections which run them at the same time.
+        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder, uint8 parts = 1)
         {
             QueryResultHolderFuture res;
-            SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
-            Enqueue(task);
-            return res;     //! Fool compiler, has no use yet
+            parts = uint8(std::min<uint32>(parts, _connectionCount[IDX_ASYNC]));
+            if (parts <= 1)
+            {
+                SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
+                Enqueue(task);
+                return res;     //! Fool compiler, has no use yet
+            }
+
+            SQLQueryHolderSplit* split = new SQLQueryHolderSplit(holder, res, parts);
+            for (uint8 i = 0; i < parts; ++i)
+                Enqueue(new SQLQueryHolderPartTask(split, i, parts));
+            return res;
         }
 
         /**
@@ -121,6 +121,9 @@ enum CharacterDatabaseStatements
     CHAR_SEL_CHARACTER_SPELLCOOLDOWNS,
     CHAR_SEL_CHARACTER_DECLINEDNAMES,
     CHAR_SEL_GUILD,
+    CHAR_SEL_GUILD_EVENTLOG,
+    CHAR_SEL_GUILD_BANK_EVENTLOG,
+    CHAR_SEL_GUILD_BANK_ITEMS,
     CHAR_SEL_GUILD_MEMBER,
     CHAR_SEL_CHARACTER_ACHIEVEMENTS,
     CHAR_SEL_ACCOUNT_ACHIEVEMENTS,
@@ -139,10 +142,10 @@ enum CharacterDatabaseStatements
     CHAR_SEL_CHARACTER_QUESTSTATUSREW,
     CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES,
     CHAR_SEL_MAILITEMS,
+    CHAR_SEL_MAILITEMS_BY_RECEIVER,
     CHAR_SEL_AUCTION_ITEMS,
     CHAR_INS_AUCTION,
     CHAR_DEL_AUCTION,
-    CHAR_SEL_AUCTION_BY_TIME,
     CHAR_UPD_AUCTION_BID,
     CHAR_SEL_AUCTIONS,
     CHAR_INS_MAIL,
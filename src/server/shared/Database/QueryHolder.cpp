@@ -19,6 +19,7 @@
 #include "QueryHolder.h"
 #include "PreparedStatement.h"
 #include "Log.h"
+#include "Timer.h"
 
 bool SQLQueryHolder::SetQuery(size_t index, const char *sql)
 {
@@ -163,27 +164,18 @@ void SQLQueryHolder::SetSize(size_t size)
 {
     /// to optimize push_back, reserve the number of queries about to be executed
     m_queries.resize(size);
+    m_queryTimes.resize(size, 0);
 }
 
-SQLQueryHolderTask::~SQLQueryHolderTask()
-{
-    if (!m_executed)
-        delete m_holder;
-}
-
-bool SQLQueryHolderTask::Execute()
+void SQLQueryHolder::ExecuteQueries(MySQLConnection* conn, uint8 part, uint8 parts)
 {
-    m_executed = true;
-    if (!m_holder)
-        return false;
-
-    /// we can do this, we are friends
-    std::vector<SQLQueryHolder::SQLResultPair> &queries = m_holder->m_queries;
-
-    for (size_t i = 0; i < queries.size(); i++)
+    /// every part takes every parts-th query, so the big ones at the start are spread out
+    for (size_t i = part; i < m_queries.size(); i += parts)
     {
+        uint32 oldMSTime = getMSTime();
+
         /// execute all queries in the holder and pass the results
-        if (SQLElementData* data = &queries[i].first)
+        if (SQLElementData* data = &m_queries[i].first)
         {
             switch (data->type)
             {
@@ -191,20 +183,71 @@ bool SQLQueryHolderTask::Execute()
                 {
                     char const* sql = data->element.query;
                     if (sql)
-                        m_holder->SetResult(i, m_conn->Query(sql));
+                        SetResult(i, conn->Query(sql));
                     break;
                 }
                 case SQL_ELEMENT_PREPARED:
                 {
                     PreparedStatement* stmt = data->element.stmt;
                     if (stmt)
-                        m_holder->SetPreparedResult(i, m_conn->Query(stmt));
+                        SetPreparedResult(i, conn->Query(stmt));
                     break;
                 }
             }
         }
+
+        m_queryTimes[i] = GetMSTimeDiffToNow(oldMSTime);
     }
+}
+
+SQLQueryHolderTask::~SQLQueryHolderTask()
+{
+    if (!m_executed)
+        delete m_holder;
+}
+
+bool SQLQueryHolderTask::Execute()
+{
+    m_executed = true;
+    if (!m_holder)
+        return false;
+
+    /// we can do this, we are friends
+    m_holder->ExecuteQueries(m_conn, 0, 1);
 
     m_result.set(m_holder);
     return true;
 }
+
+void SQLQueryHolderSplit::Finish(bool executed)
+{
+    if (!executed)
+        m_aborted = 1;
+
+    if (--m_pending)
+        return;
+
+    /// a part dropped unexecuted (queue closed at shutdown), nobody will get the results
+    if (m_aborted.value())
+        delete m_holder;
+    else
+        m_result.set(m_holder);
+
+    delete this;
+}
+
+SQLQueryHolderPartTask::~SQLQueryHolderPartTask()
+{
+    if (!m_executed)
+        m_split->Finish(false);
+}
+
+bool SQLQueryHolderPartTask::Execute()
+{
+    m_executed = true;
+
+    /// parts only touch their own queries and results, the vectors are never resized here
+    m_split->GetHolder()->ExecuteQueries(m_conn, m_part, m_parts);
+    m_split->Finish(true);
+    return true;
+}
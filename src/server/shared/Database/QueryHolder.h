@@ -19,13 +19,19 @@
 #define _QUERYHOLDER_H
 
 #include <ace/Future.h>
+#include <ace/Atomic_Op.h>
+#include <ace/Thread_Mutex.h>
 
 class SQLQueryHolder
 {
     friend class SQLQueryHolderTask;
+    friend class SQLQueryHolderPartTask;
     private:
         typedef std::pair<SQLElementData, SQLResultSetUnion> SQLResultPair;
         std::vector<SQLResultPair> m_queries;
+        std::vector<uint32> m_queryTimes;                   // execution time of each query in ms
+
+        void ExecuteQueries(MySQLConnection* conn, uint8 part, uint8 parts);
     public:
         SQLQueryHolder() {}
         ~SQLQueryHolder();
@@ -37,6 +43,7 @@ class SQLQueryHolder
         PreparedQueryResult GetPreparedResult(size_t index);
         void SetResult(size_t index, ResultSet* result);
         void SetPreparedResult(size_t index, PreparedResultSet* result);
+        uint32 GetQueryTime(size_t index) const { return index < m_queryTimes.size() ? m_queryTimes[index] : 0; }
 };
 
 typedef ACE_Future<SQLQueryHolder*> QueryResultHolderFuture;
@@ -56,4 +63,37 @@ class SQLQueryHolderTask : public SQLOperation
 
 };
 
+// State shared by the parts of a holder that runs on several async connections at once,
+// the last part to finish hands the holder over
+class SQLQueryHolderSplit
+{
+    public:
+        SQLQueryHolderSplit(SQLQueryHolder* holder, QueryResultHolderFuture res, uint8 parts)
+            : m_holder(holder), m_result(res), m_pending(parts), m_aborted(0) {}
+
+        SQLQueryHolder* GetHolder() const { return m_holder; }
+        void Finish(bool executed);
+
+    private:
+        SQLQueryHolder* m_holder;
+        QueryResultHolderFuture m_result;
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint32> m_pending;
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint32> m_aborted;
+};
+
+class SQLQueryHolderPartTask : public SQLOperation
+{
+    private:
+        SQLQueryHolderSplit* m_split;
+        uint8 m_part;
+        uint8 m_parts;
+        bool m_executed;
+
+    public:
+        SQLQueryHolderPartTask(SQLQueryHolderSplit* split, uint8 part, uint8 parts)
+            : m_split(split), m_part(part), m_parts(parts), m_executed(false) {};
+        ~SQLQueryHolderPartTask();
+        bool Execute();
+};
+
 #endif
\ No newline at end of file
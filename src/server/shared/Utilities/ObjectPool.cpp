@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+
+#include <new>
+
+ObjectPool::FreeList::~FreeList()
+{
+    while (head)
+    {
+        Block* block = head;
+        head = block->next;
+        ::operator delete(block);
+    }
+}
+
+ObjectPool::ObjectPool(char const* name, size_t blockSize, uint32 maxCachedPerThread) :
+    _name(name), _blockSize(blockSize < sizeof(Block) ? sizeof(Block) : blockSize), _maxCached(maxCachedPerThread)
+#ifdef TRINITY_DEBUG
+    , _allocations(0), _systemAllocations(0), _inUse(0)
+#endif
+{
+    GetRegistry().push_back(this);
+}
+
+ObjectPool::PoolList& ObjectPool::GetRegistry()
+{
+    static PoolList pools;
+    return pools;
+}
+
+void* ObjectPool::Allocate(size_t size)
+{
+#ifdef TRINITY_DEBUG
+    ++_allocations;
+    ++_inUse;
+#endif
+
+    if (size <= _blockSize)
+    {
+        FreeList* freeList = _freeList;
+        if (freeList->head)
+        {
+            Block* block = freeList->head;
+            freeList->head = block->next;
+            --freeList->count;
+            return block;
+        }
+
+#ifdef TRINITY_DEBUG
+        ++_systemAllocations;
+#endif
+        return ::operator new(_blockSize);
+    }
+
+#ifdef TRINITY_DEBUG
+    ++_systemAllocations;
+#endif
+    return ::operator new(size);
+}
+
+void ObjectPool::Deallocate(void* ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+#ifdef TRINITY_DEBUG
+    --_inUse;
+#endif
+
+    if (size <= _blockSize)
+    {
+        FreeList* freeList = _freeList;
+        if (freeList->count < _maxCached)
+        {
+            Block* block = static_cast<Block*>(ptr);
+            block->next = freeList->head;
+            freeList->head = block;
+            ++freeList->count;
+            return;
+        }
+    }
+
+    ::operator delete(ptr);
+}
+
+void ObjectPool::GetStats(Stats& stats) const
+{
+    stats.name = _name;
+    stats.blockSize = _blockSize;
+#ifdef TRINITY_DEBUG
+    stats.allocations = _allocations.value();
+    stats.systemAllocations = _systemAllocations.value();
+    stats.inUse = _inUse.value();
+#else
+    stats.allocations = 0;
+    stats.systemAllocations = 0;
+    stats.inUse = 0;
+#endif
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OBJECTPOOL_H
+#define _OBJECTPOOL_H
+
+#include "Define.h"
+
+#ifdef TRINITY_DEBUG
+#include <ace/Atomic_Op.h>
+#include <ace/Thread_Mutex.h>
+#endif
+#include <ace/TSS_T.h>
+#include <vector>
+
+/*
+ * Cache of fixed size memory blocks, used by class specific operator new/delete
+ * of objects created and destroyed at high rate (Spell, UnitAura, AuraEffect).
+ * Every thread keeps its own free list, so map threads never contend; a block freed
+ * by another thread than the one allocating it simply joins the free list of the
+ * freeing thread. Requests with a different size (derived classes) bypass the pool.
+ * Allocation counters are only kept in builds with TRINITY_DEBUG (WITH_COREDEBUG).
+ */
+class ObjectPool
+{
+    public:
+        struct Stats
+        {
+            char const* name;
+            size_t blockSize;
+            long allocations;                               // operator new calls served by this pool
+            long systemAllocations;                         // allocations which had to go to the system allocator
+            long inUse;                                     // currently allocated objects
+        };
+
+        typedef std::vector<ObjectPool*> PoolList;
+
+        ObjectPool(char const* name, size_t blockSize, uint32 maxCachedPerThread);
+
+        void* Allocate(size_t size);
+        void Deallocate(void* ptr, size_t size);
+
+        // counters are always 0 unless HasStats()
+        void GetStats(Stats& stats) const;
+#ifdef TRINITY_DEBUG
+        static bool HasStats() { return true; }
+#else
+        static bool HasStats() { return false; }
+#endif
+
+        // all pools created so far, for statistics output
+        static PoolList const& GetPools() { return GetRegistry(); }
+
+    private:
+        struct Block
+        {
+            Block* next;
+        };
+
+        struct FreeList
+        {
+            FreeList() : head(NULL), count(0) { }
+            ~FreeList();
+
+            Block* head;
+            uint32 count;
+        };
+
+        static PoolList& GetRegistry();
+
+        char const* _name;
+        size_t _blockSize;
+        uint32 _maxCached;
+        ACE_TSS<FreeList> _freeList;
+
+#ifdef TRINITY_DEBUG
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> _allocations;
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> _systemAllocations;
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> _inUse;
+#endif
+};
+
+#endif
@@ -31,6 +31,7 @@
 #include "Timer.h"
 #include "WorldRunnable.h"
 #include "OutdoorPvPMgr.h"
+#include "AuctionHouseMgr.h"
 
 #define WORLD_SLEEP_CONST 25
 
@@ -91,6 +92,8 @@ void WorldRunnable::run()
 
     sWorldSocketMgr->StopNetwork();
 
+    sAuctionMgr->DeactivateSearchThreads();     // stop auction searches before the data they read is unloaded
+
     sMapMgr->UnloadAll();                     // unload all grids (including locked in memory)
     sObjectAccessor->UnloadAll();             // unload 'i_player2corpse' storage and remove from world
     sScriptMgr->Unload();